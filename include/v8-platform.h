@@ -235,6 +235,26 @@ class PageAllocator {
    */
   virtual bool SetPermissions(void* address, size_t length,
                               Permission permissions) = 0;
+
+  /**
+   * Returned by GetCurrentNumaNode() if no NUMA information is available.
+   */
+  static const int kNoNumaNode = -1;
+
+  /**
+   * Returns the NUMA node of the processor the calling thread is running on,
+   * or kNoNumaNode if the allocator does not support NUMA policies.
+   */
+  virtual int GetCurrentNumaNode() { return kNoNumaNode; }
+
+  /**
+   * Requests that pages in a range allocated by AllocatePages are backed by
+   * memory of the given NUMA node when they are first touched. Returns false
+   * if the policy could not be applied.
+   */
+  virtual bool SetNumaPolicy(void* address, size_t length, int node) {
+    return false;
+  }
 };
 
 /**
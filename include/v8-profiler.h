@@ -474,7 +474,8 @@ class V8_EXPORT OutputStream {  // NOLINT
 class V8_EXPORT HeapSnapshot {
  public:
   enum SerializationFormat {
-    kJSON = 0  // See format description near 'Serialize' method.
+    kJSON = 0,   // See format description near 'Serialize' method.
+    kBinary = 1  // Compact varint encoding, see 'Serialize' method.
   };
 
   /** Returns the root node of the heap graph. */
@@ -524,6 +525,13 @@ class V8_EXPORT HeapSnapshot {
    *
    * Nodes reference strings, other nodes, and edges by their indexes
    * in corresponding arrays.
+   *
+   * The binary format carries the same nodes, edges, samples and strings
+   * (but no allocation traces) as LEB128 varints with delta-coded node ids.
+   * It is several times smaller than JSON and is written to the stream
+   * incrementally. Its chunks are arbitrary bytes that are nevertheless
+   * passed to OutputStream::WriteAsciiChunk. Use
+   * tools/heap-snapshot-binary-to-json.py to convert it into JSON.
    */
   void Serialize(OutputStream* stream,
                  SerializationFormat format = kJSON) const;
@@ -619,6 +627,33 @@ class V8_EXPORT AllocationProfile {
     std::vector<Allocation> allocations;
   };
 
+  /**
+   * Represents a single sampled object that is still alive.
+   */
+  struct Sample {
+    /**
+     * The call-graph node that allocated the object. The lifetime of the
+     * node is scoped to the containing AllocationProfile.
+     */
+    Node* node;
+
+    /**
+     * Size of the sampled allocation object.
+     */
+    size_t size;
+
+    /**
+     * Time of the allocation in milliseconds, on the same monotonic clock
+     * as Platform::MonotonicallyIncreasingTime.
+     */
+    double allocation_time_ms;
+
+    /**
+     * The number of mark-compact garbage collections the object survived.
+     */
+    unsigned int gcs_survived;
+  };
+
   /**
    * Returns the root node of the call-graph. The root node corresponds to an
    * empty JS call-stack. The lifetime of the returned Node* is scoped to the
@@ -626,6 +661,11 @@ class V8_EXPORT AllocationProfile {
    */
   virtual Node* GetRootNode() = 0;
 
+  /**
+   * Returns the live samples the profile was built from.
+   */
+  virtual const std::vector<Sample>& GetSamples() = 0;
+
   virtual ~AllocationProfile() {}
 
   static const int kNoLineNumberInfo = Message::kNoLineNumberInfo;
@@ -874,6 +914,15 @@ class V8_EXPORT HeapProfiler {
    */
   AllocationProfile* GetAllocationProfile();
 
+  /**
+   * Like GetAllocationProfile, but only counts samples whose objects have
+   * survived at least |min_gcs_survived| mark-compact garbage collections.
+   * Fetching the profile for increasing ages buckets the live samples by
+   * age: allocation sites whose samples keep surviving full GCs are likely
+   * leaks.
+   */
+  AllocationProfile* GetAllocationProfile(unsigned int min_gcs_survived);
+
   /**
    * Deletes all snapshots taken. All previously returned pointers to
    * snapshots and their contents become invalid after this call.
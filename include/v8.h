@@ -143,6 +143,7 @@ template<typename T> class ReturnValue;
 namespace internal {
 class Arguments;
 class DeferredHandles;
+class GCTracer;
 class Heap;
 class HeapObject;
 class Isolate;
@@ -6212,6 +6213,17 @@ class V8_EXPORT ResourceConstraints {
   size_t max_zone_pool_size() const { return max_zone_pool_size_; }
   void set_max_zone_pool_size(size_t bytes) { max_zone_pool_size_ = bytes; }
 
+  /**
+   * Whether the young generation is collected by a mark-compact collector
+   * instead of the copying scavenger. Marking avoids copying survivors and
+   * can be beneficial for large young generations in which many objects
+   * survive. Ignored if V8 was built without minor mark-compact support.
+   */
+  bool use_minor_mark_compact() const { return use_minor_mark_compact_; }
+  void set_use_minor_mark_compact(bool value) {
+    use_minor_mark_compact_ = value;
+  }
+
  private:
   // max_semi_space_size_ is in KB
   size_t max_semi_space_size_in_kb_;
@@ -6222,6 +6234,7 @@ class V8_EXPORT ResourceConstraints {
   uint32_t* stack_limit_;
   size_t code_range_size_;
   size_t max_zone_pool_size_;
+  bool use_minor_mark_compact_;
 };
 
 
@@ -6507,6 +6520,17 @@ typedef void (*InterruptCallback)(Isolate* isolate, void* data);
 typedef size_t (*NearHeapLimitCallback)(void* data, size_t current_heap_limit,
                                         size_t initial_heap_limit);
 
+class GCStatistics;
+
+/**
+ * This callback is invoked after every garbage collection with statistics
+ * about it. The callback is invoked while V8 is still in the GC state and
+ * must not allocate on the V8 heap or call into JavaScript.
+ */
+typedef void (*GCStatisticsCallback)(Isolate* isolate,
+                                     const GCStatistics& statistics,
+                                     void* data);
+
 /**
  * Collection of V8 heap information.
  *
@@ -6573,17 +6597,30 @@ class V8_EXPORT HeapSpaceStatistics {
 
 class V8_EXPORT HeapObjectStatistics {
  public:
+  static const size_t kSizeBucketCount = 16;
+
   HeapObjectStatistics();
   const char* object_type() { return object_type_; }
   const char* object_sub_type() { return object_sub_type_; }
   size_t object_count() { return object_count_; }
   size_t object_size() { return object_size_; }
 
+  /**
+   * Returns the number of objects whose size falls into the given bucket.
+   * Bucket 0 holds objects smaller than 32 bytes, each following bucket
+   * covers twice the size range of the previous one, and the last bucket
+   * holds all larger objects.
+   */
+  size_t object_count_in_size_bucket(size_t bucket) {
+    return bucket < kSizeBucketCount ? size_histogram_[bucket] : 0;
+  }
+
  private:
   const char* object_type_;
   const char* object_sub_type_;
   size_t object_count_;
   size_t object_size_;
+  size_t size_histogram_[kSizeBucketCount];
 
   friend class Isolate;
 };
@@ -6601,6 +6638,139 @@ class V8_EXPORT HeapCodeStatistics {
   friend class Isolate;
 };
 
+/**
+ * Statistics about a single garbage collection.
+ *
+ * Instances of this class are passed to GCStatisticsCallback after the
+ * garbage collection finished. Times are in milliseconds, sizes in bytes.
+ */
+class V8_EXPORT GCStatistics {
+ public:
+  enum Phase {
+    kMark,
+    kSweep,
+    kEvacuate,
+    kClear,
+    kEmbedderCallbacks,
+    kNumberOfPhases
+  };
+
+  static const size_t kMaxNumberOfSpaces = 8;
+
+  GCStatistics();
+
+  /**
+   * Either kGCTypeScavenge for young generation or kGCTypeMarkSweepCompact
+   * for full garbage collections.
+   */
+  GCType gc_type() const { return gc_type_; }
+
+  /** Whether the garbage collection was trying to reduce memory usage. */
+  bool is_reducing_memory() const { return is_reducing_memory_; }
+
+  /** Monotonic time at which the pause started. */
+  double start_time() const { return start_time_; }
+
+  /** Duration of the atomic pause on the main thread. */
+  double pause_duration() const { return pause_duration_; }
+
+  /** Time spent in the given phase of the atomic pause. */
+  double phase_duration(Phase phase) const { return phase_duration_[phase]; }
+
+  /**
+   * Time spent in incremental marking steps before a full garbage collection.
+   */
+  double incremental_marking_duration() const {
+    return incremental_marking_duration_;
+  }
+
+  size_t heap_size_before() const { return heap_size_before_; }
+  size_t heap_size_after() const { return heap_size_after_; }
+  size_t freed_bytes() const {
+    return heap_size_before_ > heap_size_after_
+               ? heap_size_before_ - heap_size_after_
+               : 0;
+  }
+
+  /** Size of young generation objects moved to the old generation. */
+  size_t promoted_bytes() const { return promoted_bytes_; }
+
+  /** Size of young generation objects that stayed in the young generation. */
+  size_t survived_young_bytes() const { return survived_young_bytes_; }
+
+  /**
+   * Per-space sizes of objects before and after the garbage collection.
+   * Indices match Isolate::GetHeapSpaceStatistics.
+   */
+  size_t number_of_spaces() const { return number_of_spaces_; }
+  const char* space_name(size_t index) const { return space_name_[index]; }
+  size_t space_size_before(size_t index) const {
+    return space_size_before_[index];
+  }
+  size_t space_size_after(size_t index) const {
+    return space_size_after_[index];
+  }
+
+ private:
+  GCType gc_type_;
+  bool is_reducing_memory_;
+  double start_time_;
+  double pause_duration_;
+  double phase_duration_[kNumberOfPhases];
+  double incremental_marking_duration_;
+  size_t heap_size_before_;
+  size_t heap_size_after_;
+  size_t promoted_bytes_;
+  size_t survived_young_bytes_;
+  size_t number_of_spaces_;
+  const char* space_name_[kMaxNumberOfSpaces];
+  size_t space_size_before_[kMaxNumberOfSpaces];
+  size_t space_size_after_[kMaxNumberOfSpaces];
+
+  friend class internal::GCTracer;
+};
+
+/**
+ * Garbage collection work done by Isolate::PerformIdleGarbageCollection.
+ * Times are in milliseconds.
+ */
+class V8_EXPORT IdleGarbageCollectionStatistics {
+ public:
+  IdleGarbageCollectionStatistics();
+
+  /** Whether concurrent sweeping of the last full GC was finalized. */
+  bool finalized_sweeping() const { return finalized_sweeping_; }
+
+  /** Number of young generation garbage collections. */
+  int scavenges() const { return scavenges_; }
+
+  /** Whether incremental marking was started, e.g. by the memory reducer. */
+  bool started_incremental_marking() const {
+    return started_incremental_marking_;
+  }
+
+  /** Time spent in incremental marking steps. */
+  double incremental_marking_duration() const {
+    return incremental_marking_duration_;
+  }
+
+  /** Number of full garbage collections that finalized incremental marking. */
+  int full_gcs() const { return full_gcs_; }
+
+  /** Total time spent, including bookkeeping. */
+  double used_time() const { return used_time_; }
+
+ private:
+  bool finalized_sweeping_;
+  int scavenges_;
+  bool started_incremental_marking_;
+  double incremental_marking_duration_;
+  int full_gcs_;
+  double used_time_;
+
+  friend class internal::Heap;
+};
+
 class RetainedObjectInfo;
 
 
@@ -6836,6 +7006,27 @@ class V8_EXPORT EmbedderHeapTracer {
    */
   virtual size_t NumberOfWrappersToTrace() { return 0; }
 
+  /**
+   * Returns true if the embedder is able to trace wrappers found by V8's
+   * concurrent marking threads through |TraceV8ReferencesConcurrently|. Queried
+   * once at the beginning of each GC cycle.
+   */
+  virtual bool SupportsConcurrentTracing() { return false; }
+
+  /**
+   * Called by v8 on a concurrent marking thread with internal fields of
+   * wrappers found by that thread. Only called if |SupportsConcurrentTracing|
+   * returned true for the current GC cycle.
+   *
+   * The embedder is expected to trace its heap starting from these wrappers
+   * before returning and report all reachable wrappers back through
+   * PersistentBase::RegisterExternalReference from the calling thread. Calls
+   * may happen on several threads at once and may overlap with any of the
+   * other methods.
+   */
+  virtual void TraceV8ReferencesConcurrently(
+      const std::vector<std::pair<void*, void*> >& embedder_fields) {}
+
  protected:
   virtual ~EmbedderHeapTracer() = default;
 };
@@ -7328,6 +7519,15 @@ class V8_EXPORT Isolate {
   bool GetHeapObjectStatisticsAtLastGC(HeapObjectStatistics* object_statistics,
                                        size_t type_index);
 
+  /**
+   * Like GetHeapObjectStatisticsAtLastGC, but returns estimates that the last
+   * mark-compact GC extrapolated from a sample of the heap pages. Unlike the
+   * full statistics, sampling is cheap enough to stay enabled in production.
+   * Requires --object-stats-sampling-rate.
+   */
+  bool GetSampledHeapObjectStatisticsAtLastGC(
+      HeapObjectStatistics* object_statistics, size_t type_index);
+
   /**
    * Get statistics about code and its metadata in the heap.
    *
@@ -7692,6 +7892,24 @@ class V8_EXPORT Isolate {
    */
   bool IdleNotificationDeadline(double deadline_in_seconds);
 
+  /**
+   * Variant of IdleNotificationDeadline() for embedders that know when and
+   * for how long they will be idle, e.g. servers that are about to block on
+   * I/O. V8 finalizes concurrent sweeping, scavenges, and advances
+   * incremental marking in slices that are bounded by the deadline. The
+   * final marking pause is only done if it is expected to fit.
+   *
+   * Pass quiescent = true if no requests are in flight. V8 then also starts
+   * work that it would otherwise defer, such as a pending memory reducing
+   * GC or incremental marking that is close to its allocation limit.
+   *
+   * If statistics is not null, it receives a report of the work done.
+   * Returns true if there is no more garbage collection work to do.
+   */
+  bool PerformIdleGarbageCollection(
+      double deadline_in_seconds, bool quiescent,
+      IdleGarbageCollectionStatistics* statistics = nullptr);
+
   /**
    * Optional notification that the system is running low on memory.
    * V8 uses these notifications to attempt to free memory.
@@ -7721,6 +7939,16 @@ class V8_EXPORT Isolate {
    */
   void IsolateInBackgroundNotification();
 
+  /**
+   * Returns the number of milliseconds from now after which V8 predicts the
+   * allocation rate to become low enough for memory-reducing garbage
+   * collection, 0 if the isolate is in such a quiet period already, or a
+   * negative value if no quiet period is predicted. The prediction is only
+   * available with --predictive-memory-reducer; embedders can use it to
+   * schedule their own idle work around V8's.
+   */
+  double PredictQuietPeriodDelayInMs();
+
   /**
    * Optional notification to tell V8 the current performance requirements
    * of the embedder based on RAIL.
@@ -7821,6 +8049,19 @@ class V8_EXPORT Isolate {
   void RemoveNearHeapLimitCallback(NearHeapLimitCallback callback,
                                    size_t heap_limit);
 
+  /**
+   * Adds a callback that receives structured statistics about every garbage
+   * collection, as an alternative to parsing --trace-gc-nvp output.
+   */
+  void AddGCStatisticsCallback(GCStatisticsCallback callback,
+                               void* data = nullptr);
+
+  /**
+   * Removes a callback that was installed by AddGCStatisticsCallback.
+   */
+  void RemoveGCStatisticsCallback(GCStatisticsCallback callback,
+                                  void* data = nullptr);
+
   /**
    * Set the callback to invoke to check if code generation from
    * strings should be allowed.
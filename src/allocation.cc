@@ -189,6 +189,12 @@ bool SetPermissions(void* address, size_t size,
   return GetPageAllocator()->SetPermissions(address, size, access);
 }
 
+int GetCurrentNumaNode() { return GetPageAllocator()->GetCurrentNumaNode(); }
+
+bool SetNumaPolicy(void* address, size_t size, int node) {
+  return GetPageAllocator()->SetNumaPolicy(address, size, node);
+}
+
 byte* AllocatePage(void* address, size_t* allocated) {
   size_t page_size = AllocatePageSize();
   void* result =
@@ -131,6 +131,18 @@ inline bool SetPermissions(Address address, size_t size,
   return SetPermissions(reinterpret_cast<void*>(address), size, access);
 }
 
+// Returns the NUMA node of the processor the calling thread is running on, or
+// PageAllocator::kNoNumaNode if the page allocator does not support NUMA.
+V8_EXPORT_PRIVATE int GetCurrentNumaNode();
+
+// Requests that the pages in the range are backed by memory of NUMA |node|
+// once they are touched. |address| and |size| must be multiples of
+// CommitPageSize(). Returns true on success, otherwise false.
+V8_EXPORT_PRIVATE bool SetNumaPolicy(void* address, size_t size, int node);
+inline bool SetNumaPolicy(Address address, size_t size, int node) {
+  return SetNumaPolicy(reinterpret_cast<void*>(address), size, node);
+}
+
 // Convenience function that allocates a single system page with read and write
 // permissions. |address| is a hint. Returns the base address of the memory and
 // the page size via |allocated| on success. Returns nullptr on failure.
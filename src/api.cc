@@ -43,6 +43,7 @@
 #include "src/gdb-jit.h"
 #include "src/global-handles.h"
 #include "src/globals.h"
+#include "src/heap/memory-reducer.h"
 #include "src/icu_util.h"
 #include "src/isolate-inl.h"
 #include "src/json-parser.h"
@@ -963,7 +964,8 @@ ResourceConstraints::ResourceConstraints()
       max_old_space_size_(0),
       stack_limit_(nullptr),
       code_range_size_(0),
-      max_zone_pool_size_(0) {}
+      max_zone_pool_size_(0),
+      use_minor_mark_compact_(false) {}
 
 void ResourceConstraints::ConfigureDefaults(uint64_t physical_memory,
                                             uint64_t virtual_memory_limit) {
@@ -992,6 +994,9 @@ void SetResourceConstraints(i::Isolate* isolate,
                                    code_range_size);
   }
   isolate->allocator()->ConfigureSegmentPool(max_pool_size);
+  if (constraints.use_minor_mark_compact()) {
+    isolate->heap()->ConfigureYoungGenerationCollector(true);
+  }
 
   if (constraints.stack_limit() != nullptr) {
     uintptr_t limit = reinterpret_cast<uintptr_t>(constraints.stack_limit());
@@ -6009,6 +6014,33 @@ HeapStatistics::HeapStatistics()
       number_of_native_contexts_(0),
       number_of_detached_contexts_(0) {}
 
+IdleGarbageCollectionStatistics::IdleGarbageCollectionStatistics()
+    : finalized_sweeping_(false),
+      scavenges_(0),
+      started_incremental_marking_(false),
+      incremental_marking_duration_(0),
+      full_gcs_(0),
+      used_time_(0) {}
+
+GCStatistics::GCStatistics()
+    : gc_type_(kGCTypeScavenge),
+      is_reducing_memory_(false),
+      start_time_(0),
+      pause_duration_(0),
+      incremental_marking_duration_(0),
+      heap_size_before_(0),
+      heap_size_after_(0),
+      promoted_bytes_(0),
+      survived_young_bytes_(0),
+      number_of_spaces_(0) {
+  for (int i = 0; i < kNumberOfPhases; i++) phase_duration_[i] = 0;
+  for (size_t i = 0; i < kMaxNumberOfSpaces; i++) {
+    space_name_[i] = nullptr;
+    space_size_before_[i] = 0;
+    space_size_after_[i] = 0;
+  }
+}
+
 HeapSpaceStatistics::HeapSpaceStatistics(): space_name_(0),
                                             space_size_(0),
                                             space_used_size_(0),
@@ -6020,7 +6052,9 @@ HeapObjectStatistics::HeapObjectStatistics()
     : object_type_(nullptr),
       object_sub_type_(nullptr),
       object_count_(0),
-      object_size_(0) {}
+      object_size_(0) {
+  for (size_t i = 0; i < kSizeBucketCount; i++) size_histogram_[i] = 0;
+}
 
 HeapCodeStatistics::HeapCodeStatistics()
     : code_and_metadata_size_(0), bytecode_and_metadata_size_(0) {}
@@ -8445,6 +8479,37 @@ bool Isolate::GetHeapObjectStatisticsAtLastGC(
   object_statistics->object_sub_type_ = object_sub_type;
   object_statistics->object_count_ = object_count;
   object_statistics->object_size_ = object_size;
+  for (size_t i = 0; i < HeapObjectStatistics::kSizeBucketCount; i++) {
+    object_statistics->size_histogram_[i] =
+        heap->ObjectSizeHistogramAtLastGC(type_index, i);
+  }
+  return true;
+}
+
+bool Isolate::GetSampledHeapObjectStatisticsAtLastGC(
+    HeapObjectStatistics* object_statistics, size_t type_index) {
+  if (!object_statistics) return false;
+  if (V8_LIKELY(i::FLAG_object_stats_sampling_rate == 0)) return false;
+
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::Heap* heap = isolate->heap();
+  if (type_index >= heap->NumberOfTrackedHeapObjectTypes()) return false;
+
+  const char* object_type;
+  const char* object_sub_type;
+  if (!heap->GetObjectTypeName(type_index, &object_type, &object_sub_type)) {
+    return false;
+  }
+
+  object_statistics->object_type_ = object_type;
+  object_statistics->object_sub_type_ = object_sub_type;
+  object_statistics->object_count_ =
+      heap->SampledObjectCountAtLastGC(type_index);
+  object_statistics->object_size_ = heap->SampledObjectSizeAtLastGC(type_index);
+  for (size_t i = 0; i < HeapObjectStatistics::kSizeBucketCount; i++) {
+    object_statistics->size_histogram_[i] =
+        heap->SampledObjectSizeHistogramAtLastGC(type_index, i);
+  }
   return true;
 }
 
@@ -8632,6 +8697,16 @@ bool Isolate::IdleNotificationDeadline(double deadline_in_seconds) {
   return isolate->heap()->IdleNotification(deadline_in_seconds);
 }
 
+bool Isolate::PerformIdleGarbageCollection(
+    double deadline_in_seconds, bool quiescent,
+    IdleGarbageCollectionStatistics* statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (statistics != nullptr) *statistics = IdleGarbageCollectionStatistics();
+  if (!i::FLAG_use_idle_notification) return true;
+  return isolate->heap()->PerformIdleGarbageCollection(deadline_in_seconds,
+                                                       quiescent, statistics);
+}
+
 void Isolate::LowMemoryNotification() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   {
@@ -8676,6 +8751,13 @@ void Isolate::IsolateInBackgroundNotification() {
   return isolate->IsolateInBackgroundNotification();
 }
 
+double Isolate::PredictQuietPeriodDelayInMs() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  i::MemoryReducer* memory_reducer = isolate->heap()->memory_reducer();
+  if (memory_reducer == nullptr) return -1;
+  return memory_reducer->PredictQuietPeriodDelayMs();
+}
+
 void Isolate::MemoryPressureNotification(MemoryPressureLevel level) {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   bool on_isolate_thread =
@@ -8763,6 +8845,18 @@ void Isolate::RemoveNearHeapLimitCallback(v8::NearHeapLimitCallback callback,
   isolate->heap()->RemoveNearHeapLimitCallback(callback, heap_limit);
 }
 
+void Isolate::AddGCStatisticsCallback(GCStatisticsCallback callback,
+                                      void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->AddStatisticsCallback(callback, data);
+}
+
+void Isolate::RemoveGCStatisticsCallback(GCStatisticsCallback callback,
+                                         void* data) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  isolate->heap()->tracer()->RemoveStatisticsCallback(callback, data);
+}
+
 bool Isolate::IsDead() {
   i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
   return isolate->IsDead();
@@ -10211,12 +10305,17 @@ SnapshotObjectId HeapSnapshot::GetMaxSnapshotJSObjectId() const {
 
 void HeapSnapshot::Serialize(OutputStream* stream,
                              HeapSnapshot::SerializationFormat format) const {
-  Utils::ApiCheck(format == kJSON,
+  Utils::ApiCheck(format == kJSON || format == kBinary,
                   "v8::HeapSnapshot::Serialize",
                   "Unknown serialization format");
   Utils::ApiCheck(stream->GetChunkSize() > 0,
                   "v8::HeapSnapshot::Serialize",
                   "Invalid stream chunk size");
+  if (format == kBinary) {
+    i::HeapSnapshotBinarySerializer serializer(ToInternal(this));
+    serializer.Serialize(stream);
+    return;
+  }
   i::HeapSnapshotJSONSerializer serializer(ToInternal(this));
   serializer.Serialize(stream);
 }
@@ -10296,7 +10395,14 @@ void HeapProfiler::StopSamplingHeapProfiler() {
 
 
 AllocationProfile* HeapProfiler::GetAllocationProfile() {
-  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile();
+  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile(0);
+}
+
+
+AllocationProfile* HeapProfiler::GetAllocationProfile(
+    unsigned int min_gcs_survived) {
+  return reinterpret_cast<i::HeapProfiler*>(this)->GetAllocationProfile(
+      min_gcs_survived);
 }
 
 
@@ -6,6 +6,11 @@
 
 #include "src/base/platform/platform.h"
 
+#if V8_OS_LINUX
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
 namespace v8 {
 namespace base {
 
@@ -60,5 +65,36 @@ bool PageAllocator::SetPermissions(void* address, size_t size,
       address, size, static_cast<base::OS::MemoryPermission>(access));
 }
 
+#if V8_OS_LINUX && defined(__NR_getcpu) && defined(__NR_mbind)
+
+int PageAllocator::GetCurrentNumaNode() {
+  unsigned cpu = 0;
+  unsigned node = 0;
+  if (syscall(__NR_getcpu, &cpu, &node, nullptr) != 0) return kNoNumaNode;
+  return static_cast<int>(node);
+}
+
+bool PageAllocator::SetNumaPolicy(void* address, size_t size, int node) {
+  // Values from <numaif.h>, which is not available on all systems.
+  const int kMpolPreferred = 1;
+  // The node mask is an array of unsigned long, which has the size of a
+  // pointer on Linux.
+  const uintptr_t kBitsPerMask = 8 * sizeof(uintptr_t);
+  if (node < 0 || static_cast<uintptr_t>(node) >= kBitsPerMask) return false;
+  uintptr_t node_mask = static_cast<uintptr_t>(1) << node;
+  return syscall(__NR_mbind, address, size, kMpolPreferred, &node_mask,
+                 kBitsPerMask, 0) == 0;
+}
+
+#else
+
+int PageAllocator::GetCurrentNumaNode() { return kNoNumaNode; }
+
+bool PageAllocator::SetNumaPolicy(void* address, size_t size, int node) {
+  return false;
+}
+
+#endif  // V8_OS_LINUX && defined(__NR_getcpu) && defined(__NR_mbind)
+
 }  // namespace base
 }  // namespace v8
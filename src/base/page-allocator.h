@@ -34,6 +34,10 @@ class V8_BASE_EXPORT PageAllocator
 
   bool SetPermissions(void* address, size_t size,
                       PageAllocator::Permission access) override;
+
+  int GetCurrentNumaNode() override;
+
+  bool SetNumaPolicy(void* address, size_t size, int node) override;
 };
 
 }  // namespace base
@@ -50,6 +50,14 @@ void CompilationStatistics::RecordTotalStats(size_t source_size,
 }
 
 
+void CompilationStatistics::RecordCounter(const char* counter_name,
+                                          size_t value) {
+  base::LockGuard<base::Mutex> guard(&record_mutex_);
+
+  counter_map_[std::string(counter_name)] += value;
+}
+
+
 void CompilationStatistics::BasicStats::Accumulate(const BasicStats& stats) {
   delta_ += stats.delta_;
   total_allocated_bytes_ += stats.total_allocated_bytes_;
@@ -92,6 +100,21 @@ static void WriteLine(std::ostream& os, bool machine_format, const char* name,
 }
 
 
+static void WriteCounterLine(std::ostream& os, bool machine_format,
+                             const char* name, size_t value) {
+  const size_t kBufferSize = 128;
+  char buffer[kBufferSize];
+
+  if (machine_format) {
+    base::OS::SNPrintF(buffer, kBufferSize, "\n\"%s\"=%" PRIuS, name, value);
+  } else {
+    base::OS::SNPrintF(buffer, kBufferSize, "%28s %10" PRIuS "\n", name,
+                       value);
+  }
+  os << buffer;
+}
+
+
 static void WriteFullLine(std::ostream& os) {
   os << "--------------------------------------------------------"
         "--------------------------------------------------------\n";
@@ -155,6 +178,12 @@ std::ostream& operator<<(std::ostream& os, const AsPrintableStatistics& ps) {
   if (!ps.machine_output) WriteFullLine(os);
   WriteLine(os, ps.machine_output, "totals", s.total_stats_, s.total_stats_);
 
+  if (!ps.machine_output && !s.counter_map_.empty()) WriteFullLine(os);
+  for (const auto& counter : s.counter_map_) {
+    WriteCounterLine(os, ps.machine_output, counter.first.c_str(),
+                     counter.second);
+  }
+
   return os;
 }
 
@@ -50,6 +50,10 @@ class CompilationStatistics final : public Malloced {
 
   void RecordTotalStats(size_t source_size, const BasicStats& stats);
 
+  // Adds {value} to the counter {counter_name}, e.g. the number of nodes
+  // that an optimization removed.
+  void RecordCounter(const char* counter_name, size_t value);
+
  private:
   class TotalStats : public BasicStats {
    public:
@@ -76,10 +80,12 @@ class CompilationStatistics final : public Malloced {
   typedef OrderedStats PhaseKindStats;
   typedef std::map<std::string, PhaseKindStats> PhaseKindMap;
   typedef std::map<std::string, PhaseStats> PhaseMap;
+  typedef std::map<std::string, size_t> CounterMap;
 
   TotalStats total_stats_;
   PhaseKindMap phase_kind_map_;
   PhaseMap phase_map_;
+  CounterMap counter_map_;
   base::Mutex record_mutex_;
 
   DISALLOW_COPY_AND_ASSIGN(CompilationStatistics);
@@ -702,6 +702,12 @@ MaybeHandle<Code> GetOptimizedCode(Handle<JSFunction> function,
   DCHECK(shared->is_compiled());
   function->feedback_vector()->set_profiler_ticks(0);
 
+  // Pretenuring decisions matter for optimized code, so remember those of
+  // hot functions for the code cache.
+  if (FLAG_allocation_site_pretenuring && FLAG_code_cache_pretenuring_hints) {
+    function->feedback_vector()->RecordPretenuringHints();
+  }
+
   VMState<COMPILER> state(isolate);
   DCHECK(!isolate->has_pending_exception());
   PostponeInterruptsScope postpone(isolate);
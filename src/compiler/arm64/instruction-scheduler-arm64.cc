@@ -360,7 +360,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr,
+                                                bool tune_for_host) {
   // Basic latency modeling for arm64 instructions. They have been determined
   // in an empirical way.
   switch (instr->arch_opcode()) {
@@ -19,7 +19,8 @@ BranchElimination::BranchElimination(Editor* editor, JSGraph* js_graph,
       node_conditions_(js_graph->graph()->NodeCount(), zone),
       reduced_(js_graph->graph()->NodeCount(), zone),
       zone_(zone),
-      dead_(js_graph->Dead()) {}
+      dead_(js_graph->Dead()),
+      eliminated_bounds_checks_(0) {}
 
 BranchElimination::~BranchElimination() {}
 
@@ -28,6 +29,8 @@ Reduction BranchElimination::Reduce(Node* node) {
   switch (node->opcode()) {
     case IrOpcode::kDead:
       return NoChange();
+    case IrOpcode::kCheckBounds:
+      return ReduceCheckBounds(node);
     case IrOpcode::kDeoptimizeIf:
     case IrOpcode::kDeoptimizeUnless:
       return ReduceDeoptimizeConditional(node);
@@ -130,6 +133,47 @@ Reduction BranchElimination::ReduceDeoptimizeConditional(Node* node) {
   return UpdateConditions(node, conditions, condition, node, condition_is_true);
 }
 
+Reduction BranchElimination::ReduceCheckBounds(Node* node) {
+  if (!FLAG_turbo_bounds_check_elimination) return NoChange();
+  Node* const index = NodeProperties::GetValueInput(node, 0);
+  Node* const length = NodeProperties::GetValueInput(node, 1);
+  Node* const effect = NodeProperties::GetEffectInput(node);
+  Node* const control = NodeProperties::GetControlInput(node);
+  // If we do not know anything about the control input, do not try yet
+  // because we will be revisited once it is computed.
+  if (!reduced_.Get(control)) return NoChange();
+
+  // The {index} has to be a non-negative integer, which for induction
+  // variables the Typer usually knows from the loop bounds. Types are only
+  // available before SimplifiedLowering.
+  if (!NodeProperties::IsTyped(index)) return NoChange();
+  Type* const index_type = NodeProperties::GetType(index);
+  if (index_type->IsNone() || !index_type->Is(Type::Integral32()) ||
+      index_type->Min() < 0.0) {
+    return NoChange();
+  }
+
+  // Look for a comparison {index < length} that is known to be true on the
+  // path to {node}. LoadElimination running alongside us makes sure that
+  // repeated loads of an array's length are the same {length} node.
+  ControlPathConditions conditions = node_conditions_.Get(control);
+  for (Node* const use : index->uses()) {
+    if (use->opcode() != IrOpcode::kNumberLessThan &&
+        use->opcode() != IrOpcode::kSpeculativeNumberLessThan) {
+      continue;
+    }
+    if (use->InputAt(0) != index || use->InputAt(1) != length) continue;
+    Node* branch;
+    bool is_true;
+    if (conditions.LookupCondition(use, &branch, &is_true) && is_true) {
+      eliminated_bounds_checks_++;
+      ReplaceWithValue(node, index, effect, control);
+      return Replace(index);
+    }
+  }
+  return NoChange();
+}
+
 Reduction BranchElimination::ReduceIf(Node* node, bool is_true_branch) {
   // Add the condition to the list arriving from the input branch.
   Node* branch = NodeProperties::GetControlInput(node, 0);
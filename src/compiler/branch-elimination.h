@@ -29,6 +29,10 @@ class V8_EXPORT_PRIVATE BranchElimination final
 
   Reduction Reduce(Node* node) final;
 
+  // Number of CheckBounds nodes removed because a dominating branch already
+  // established {index < length}.
+  size_t eliminated_bounds_checks() const { return eliminated_bounds_checks_; }
+
  private:
   struct BranchCondition {
     Node* condition;
@@ -56,6 +60,7 @@ class V8_EXPORT_PRIVATE BranchElimination final
   };
 
   Reduction ReduceBranch(Node* node);
+  Reduction ReduceCheckBounds(Node* node);
   Reduction ReduceDeoptimizeConditional(Node* node);
   Reduction ReduceIf(Node* node, bool is_true_branch);
   Reduction ReduceLoop(Node* node);
@@ -83,6 +88,7 @@ class V8_EXPORT_PRIVATE BranchElimination final
   NodeAuxData<bool> reduced_;
   Zone* zone_;
   Node* dead_;
+  size_t eliminated_bounds_checks_;
 };
 
 }  // namespace compiler
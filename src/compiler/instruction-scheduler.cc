@@ -62,11 +62,12 @@ InstructionScheduler::StressSchedulerQueue::PopBestCandidate(int cycle) {
 
 InstructionScheduler::ScheduleGraphNode::ScheduleGraphNode(
     Zone* zone,
-    Instruction* instr)
+    Instruction* instr,
+    int latency)
     : instr_(instr),
       successors_(zone),
       unscheduled_predecessors_count_(0),
-      latency_(GetInstructionLatency(instr)),
+      latency_(latency),
       total_latency_(-1),
       start_cycle_(-1) {
 }
@@ -83,6 +84,7 @@ InstructionScheduler::InstructionScheduler(Zone* zone,
     : zone_(zone),
       sequence_(sequence),
       graph_(zone),
+      tune_for_host_(!sequence->isolate()->serializer_enabled()),
       last_side_effect_instr_(nullptr),
       pending_loads_(zone),
       last_live_in_reg_marker_(nullptr),
@@ -115,8 +117,14 @@ void InstructionScheduler::EndBlock(RpoNumber rpo) {
   operands_map_.clear();
 }
 
+InstructionScheduler::ScheduleGraphNode* InstructionScheduler::NewNode(
+    Instruction* instr) {
+  return new (zone()) ScheduleGraphNode(
+      zone(), instr, GetInstructionLatency(instr, tune_for_host_));
+}
+
 void InstructionScheduler::AddTerminator(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node = NewNode(instr);
   // Make sure that basic block terminators are not moved by adding them
   // as successor of every instruction.
   for (ScheduleGraphNode* node : graph_) {
@@ -126,7 +134,7 @@ void InstructionScheduler::AddTerminator(Instruction* instr) {
 }
 
 void InstructionScheduler::AddInstruction(Instruction* instr) {
-  ScheduleGraphNode* new_node = new (zone()) ScheduleGraphNode(zone(), instr);
+  ScheduleGraphNode* new_node = NewNode(instr);
 
   // We should not have branches in the middle of a block.
   DCHECK_NE(instr->flags_mode(), kFlags_branch);
@@ -38,12 +38,18 @@ class InstructionScheduler final : public ZoneObject {
 
   static bool SchedulerSupported();
 
+  // Returns the latency of {instr} in cycles. Targets that model several
+  // microarchitectures use the one of the host CPU if {tune_for_host} is set,
+  // and a generic model otherwise.
+  static int GetInstructionLatency(const Instruction* instr,
+                                   bool tune_for_host);
+
  private:
   // A scheduling graph node.
   // Represent an instruction and their dependencies.
   class ScheduleGraphNode: public ZoneObject {
    public:
-    ScheduleGraphNode(Zone* zone, Instruction* instr);
+    ScheduleGraphNode(Zone* zone, Instruction* instr, int latency);
 
     // Mark the instruction represented by 'node' as a dependecy of this one.
     // The current instruction will be registered as an unscheduled predecessor
@@ -194,16 +200,21 @@ class InstructionScheduler final : public ZoneObject {
 
   void ComputeTotalLatencies();
 
-  static int GetInstructionLatency(const Instruction* instr);
-
   Zone* zone() { return zone_; }
   InstructionSequence* sequence() { return sequence_; }
   Isolate* isolate() { return sequence()->isolate(); }
 
+  // Creates a scheduling graph node for {instr}.
+  ScheduleGraphNode* NewNode(Instruction* instr);
+
   Zone* zone_;
   InstructionSequence* sequence_;
   ZoneVector<ScheduleGraphNode*> graph_;
 
+  // Whether latencies may be tuned for the host CPU. Code that is serialized
+  // into a snapshot must not depend on the machine that built it.
+  const bool tune_for_host_;
+
   friend class InstructionSchedulerTester;
 
   // Last side effect instruction encountered while building the graph.
@@ -763,9 +763,10 @@ Reduction JSCreateLowering::ReduceJSCreateArray(Node* node) {
   Handle<JSFunction> constructor(native_context()->array_function(), isolate());
   Node* target = NodeProperties::GetValueInput(node, 0);
   Node* new_target = NodeProperties::GetValueInput(node, 1);
-  Type* new_target_type = (target == new_target)
-                              ? Type::HeapConstant(constructor, zone())
-                              : NodeProperties::GetType(new_target);
+  Type* new_target_type =
+      (target == new_target)
+          ? Type::HeapConstant(js_heap_broker(), constructor, zone())
+          : NodeProperties::GetType(new_target);
 
   // Extract original constructor function.
   if (new_target_type->IsHeapConstant() &&
@@ -0,0 +1,82 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/js-heap-broker.h"
+
+#include "src/heap/factory.h"
+#include "src/isolate.h"
+#include "src/objects-inl.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+JSHeapBroker::JSHeapBroker(Isolate* isolate, Zone* zone)
+    : isolate_(isolate), snapshot_(zone) {}
+
+void JSHeapBroker::SerializeStandardObjects() {
+  Factory* factory = isolate()->factory();
+  Serialize(factory->empty_string());
+  Serialize(factory->NaN_string());
+  Serialize(factory->zero_string());
+  Serialize(factory->false_value());
+  Serialize(factory->true_value());
+  Serialize(factory->the_hole_value());
+  Serialize(factory->undefined_value());
+  Serialize(factory->null_value());
+  Serialize(factory->infinity_value());
+  Serialize(factory->minus_infinity_value());
+  Serialize(factory->minus_zero_value());
+  Serialize(factory->nan_value());
+}
+
+void JSHeapBroker::Serialize(Handle<HeapObject> object) {
+  AllowHandleDereference allow_handle_dereference;
+  snapshot_.emplace(reinterpret_cast<Address>(object.location()),
+                    HeapObjectTypeFromMap(object->map()));
+}
+
+HeapObjectType JSHeapBroker::HeapObjectTypeOf(
+    Handle<HeapObject> object) const {
+  auto it = snapshot_.find(reinterpret_cast<Address>(object.location()));
+  if (it != snapshot_.end()) return it->second;
+  // Objects missing from the snapshot can only be inspected on the main
+  // thread, where the heap is not mutated concurrently.
+  DCHECK(ThreadId::Current().Equals(isolate()->thread_id()));
+  AllowHandleDereference allow_handle_dereference;
+  return HeapObjectTypeFromMap(object->map());
+}
+
+// static
+HeapObjectType JSHeapBroker::HeapObjectTypeFromMap(Map* map) {
+  OddballType oddball_type = OddballType::kNone;
+  if (map->instance_type() == ODDBALL_TYPE) {
+    Heap* heap = map->GetHeap();
+    if (map == heap->undefined_map()) {
+      oddball_type = OddballType::kUndefined;
+    } else if (map == heap->null_map()) {
+      oddball_type = OddballType::kNull;
+    } else if (map == heap->boolean_map()) {
+      oddball_type = OddballType::kBoolean;
+    } else if (map == heap->the_hole_map()) {
+      oddball_type = OddballType::kHole;
+    } else {
+      DCHECK(map == heap->uninitialized_map() ||
+             map == heap->termination_exception_map() ||
+             map == heap->arguments_marker_map() ||
+             map == heap->optimized_out_map() ||
+             map == heap->stale_register_map());
+      oddball_type = OddballType::kOther;
+    }
+  }
+  HeapObjectType::Flags flags(0);
+  if (map->is_undetectable()) flags |= HeapObjectType::kUndetectable;
+  if (map->is_callable()) flags |= HeapObjectType::kCallable;
+
+  return HeapObjectType(map->instance_type(), flags, oddball_type);
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,94 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_JS_HEAP_BROKER_H_
+#define V8_COMPILER_JS_HEAP_BROKER_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/base/flags.h"
+#include "src/globals.h"
+#include "src/handles.h"
+#include "src/objects.h"
+#include "src/zone/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+enum class OddballType : uint8_t {
+  kNone,     // Not an Oddball.
+  kBoolean,  // True or False.
+  kUndefined,
+  kNull,
+  kHole,
+  kOther,  // Oddball, but none of the above.
+};
+
+// The parts of a heap object's map that the type system looks at. They do not
+// change after the map is created, so a copy taken on the main thread stays
+// valid for the whole compilation.
+class HeapObjectType {
+ public:
+  enum Flag : uint8_t { kUndetectable = 1 << 0, kCallable = 1 << 1 };
+
+  typedef base::Flags<Flag> Flags;
+
+  HeapObjectType(InstanceType instance_type, Flags flags,
+                 OddballType oddball_type)
+      : instance_type_(instance_type),
+        oddball_type_(oddball_type),
+        flags_(flags) {
+    DCHECK_EQ(instance_type == ODDBALL_TYPE,
+              oddball_type != OddballType::kNone);
+  }
+
+  OddballType oddball_type() const { return oddball_type_; }
+  InstanceType instance_type() const { return instance_type_; }
+  Flags flags() const { return flags_; }
+
+  bool is_callable() const { return flags_ & kCallable; }
+  bool is_undetectable() const { return flags_ & kUndetectable; }
+
+ private:
+  InstanceType instance_type_;
+  OddballType oddball_type_;
+  Flags flags_;
+};
+
+// Answers the questions that the type system asks about heap objects. Objects
+// serialized on the main thread are answered from a snapshot, so that phases
+// running on the background thread do not read the heap for them.
+class V8_EXPORT_PRIVATE JSHeapBroker : public NON_EXPORTED_BASE(ZoneObject) {
+ public:
+  JSHeapBroker(Isolate* isolate, Zone* zone);
+
+  // Snapshots the root objects that the OperationTyper, the Typer and the
+  // typed lowerings build constant types for. Main thread only.
+  void SerializeStandardObjects();
+
+  // Snapshots the given object. Main thread only.
+  void Serialize(Handle<HeapObject> object);
+
+  // Returns the snapshot of the given object if there is one and reads its
+  // map otherwise.
+  HeapObjectType HeapObjectTypeOf(Handle<HeapObject> object) const;
+
+  static HeapObjectType HeapObjectTypeFromMap(Map* map);
+
+  Isolate* isolate() const { return isolate_; }
+
+ private:
+  Isolate* const isolate_;
+  // Keyed by handle location. TurboFan canonicalizes its handles, so there is
+  // one location per object.
+  ZoneUnorderedMap<Address, HeapObjectType> snapshot_;
+
+  DISALLOW_COPY_AND_ASSIGN(JSHeapBroker);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_JS_HEAP_BROKER_H_
@@ -0,0 +1,228 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/loop-unrolling.h"
+
+#include <algorithm>
+
+#include "src/compiler/common-operator.h"
+#include "src/compiler/compiler-source-position-table.h"
+#include "src/compiler/graph.h"
+#include "src/compiler/loop-peeling.h"
+#include "src/compiler/node-marker.h"
+#include "src/compiler/node-properties.h"
+#include "src/compiler/node.h"
+#include "src/zone/zone.h"
+
+// Loop unrolling copies the body of an innermost loop so that one trip
+// around the backedge executes several iterations. For an unroll count of
+// two, and using the notation of loop-peeling.cc, the loop
+//
+//           ( Loop )<------------- ( phiA ) <-------------------+
+//              |                      |                         |
+//      ((======P======================U============))          |
+//      ((     body                                  ))          |
+//      ((===K====L==================================))          |
+//           |    |                                              |
+//           |    +----------------------------------------------+
+//          exit
+//
+// becomes
+//
+//           ( Loop )<------------- ( phiA ) <-------------------+
+//              |                      |                         |
+//      ((======P======================U============))          |
+//      ((     body                                  ))          |
+//      ((===K====L==================================))          |
+//           |    |                                              |
+//           |  ((=P'======================U'=======))           |
+//           |  ((  body'                           ))           |
+//           |  ((==K'====L'========================))           |
+//           |     |      |                                      |
+//           |     |      +--------------------------------------+
+//           |     |
+//          Merge--+
+//            |
+//           exit
+//
+// The header nodes of the copy map to the backedge values of the previous
+// iteration, and the backedge of the loop is taken from the last copy. The
+// exits of all iterations are merged, with LoopExitValue and LoopExitEffect
+// markers turned into phis on that merge.
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+bool LoopUnroller::CanUnroll(LoopTree::Loop* loop) {
+  // Only innermost loops with a single backedge are unrolled, and, as for
+  // peeling, every use outside of the loop has to go through a loop exit.
+  if (!loop->children().empty()) return false;
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  if (loop_node->InputCount() != 2) return false;
+  return LoopPeeler(graph_, common_, loop_tree_, tmp_zone_, source_positions_)
+      .CanPeel(loop);
+}
+
+// static
+int LoopUnroller::UnrollCountFor(LoopTree::Loop* loop) {
+  size_t const size = loop->TotalSize();
+  if (size == 0) return 1;
+  size_t const count =
+      std::min(kMaxUnrolledNodes / size, static_cast<size_t>(kMaxUnrollCount));
+  return std::max(1, static_cast<int>(count));
+}
+
+void LoopUnroller::Unroll(LoopTree::Loop* loop, int unroll_count) {
+  DCHECK(CanUnroll(loop));
+  DCHECK_LE(2, unroll_count);
+  Node* loop_node = loop_tree_->GetLoopControl(loop);
+  size_t const loop_size = loop->TotalSize();
+
+  // Number the loop nodes; {index} is 0 for nodes outside of the loop.
+  NodeMarker<size_t> index(graph_, static_cast<uint32_t>(loop_size + 1));
+  size_t count = 0;
+  for (Node* node : loop_tree_->LoopNodes(loop)) index.Set(node, ++count);
+
+  // The copies of iteration {i} live at [i * loop_size, (i + 1) * loop_size).
+  // Iteration 0 is the original loop.
+  NodeVector copies(unroll_count * loop_size, nullptr, tmp_zone_);
+  auto map = [&](int iteration, Node* node) {
+    size_t const i = index.Get(node);
+    if (i == 0) return node;
+    Node* copy = copies[iteration * loop_size + i - 1];
+    return copy == nullptr ? node : copy;
+  };
+  auto insert = [&](int iteration, Node* node, Node* copy) {
+    copies[iteration * loop_size + index.Get(node) - 1] = copy;
+  };
+  for (Node* node : loop_tree_->LoopNodes(loop)) insert(0, node, node);
+
+  NodeVector inputs(tmp_zone_);
+  for (int iteration = 1; iteration < unroll_count; ++iteration) {
+    // The header nodes take the backedge values of the previous iteration.
+    for (Node* node : loop_tree_->HeaderNodes(loop)) {
+      insert(iteration, node, map(iteration - 1, node->InputAt(1)));
+    }
+
+    // Copy the body. Inputs that are copied later are fixed up below.
+    for (Node* node : loop_tree_->BodyNodes(loop)) {
+      SourcePositionTable::Scope position(
+          source_positions_, source_positions_->GetSourcePosition(node));
+      inputs.clear();
+      for (Node* input : node->inputs()) {
+        inputs.push_back(map(iteration, input));
+      }
+      Node* copy = graph_->NewNode(node->op(), node->InputCount(), &inputs[0]);
+      if (NodeProperties::IsTyped(node)) {
+        NodeProperties::SetType(copy, NodeProperties::GetType(node));
+      }
+      insert(iteration, node, copy);
+    }
+    for (Node* node : loop_tree_->BodyNodes(loop)) {
+      Node* copy = map(iteration, node);
+      for (int i = 0; i < copy->InputCount(); i++) {
+        copy->ReplaceInput(i, map(iteration, node->InputAt(i)));
+      }
+    }
+
+    // Copy the exits. A LoopExit stays attached to the loop node, and its
+    // markers are attached to the copied LoopExit.
+    for (Node* node : loop_tree_->ExitNodes(loop)) {
+      if (node->opcode() != IrOpcode::kLoopExit) continue;
+      Node* copy = graph_->NewNode(node->op(), map(iteration, node->InputAt(0)),
+                                   loop_node);
+      insert(iteration, node, copy);
+    }
+    for (Node* node : loop_tree_->ExitNodes(loop)) {
+      if (node->opcode() == IrOpcode::kLoopExit) continue;
+      Node* copy = graph_->NewNode(node->op(), map(iteration, node->InputAt(0)),
+                                   map(iteration, node->InputAt(1)));
+      if (NodeProperties::IsTyped(node)) {
+        NodeProperties::SetType(copy, NodeProperties::GetType(node));
+      }
+      insert(iteration, node, copy);
+    }
+  }
+
+  // Close the loop with the backedge of the last iteration.
+  for (Node* node : loop_tree_->HeaderNodes(loop)) {
+    node->ReplaceInput(1, map(unroll_count - 1, node->InputAt(1)));
+  }
+
+  // Merge the exits of all iterations.
+  NodeVector markers(tmp_zone_);
+  for (Node* exit : loop_tree_->ExitNodes(loop)) {
+    if (exit->opcode() != IrOpcode::kLoopExit) continue;
+    markers.clear();
+    for (Node* use : exit->uses()) {
+      if (use->opcode() == IrOpcode::kLoopExitValue ||
+          use->opcode() == IrOpcode::kLoopExitEffect) {
+        markers.push_back(use);
+      }
+    }
+
+    inputs.clear();
+    for (int iteration = 0; iteration < unroll_count; ++iteration) {
+      inputs.push_back(map(iteration, exit));
+    }
+    Node* merge =
+        graph_->NewNode(common_->Merge(unroll_count), unroll_count, &inputs[0]);
+    for (Edge edge : exit->use_edges()) {
+      Node* use = edge.from();
+      if (use == merge || use->opcode() == IrOpcode::kLoopExitValue ||
+          use->opcode() == IrOpcode::kLoopExitEffect) {
+        continue;
+      }
+      edge.UpdateTo(merge);
+    }
+
+    for (Node* marker : markers) {
+      inputs.clear();
+      for (int iteration = 0; iteration < unroll_count; ++iteration) {
+        inputs.push_back(map(iteration, marker));
+      }
+      inputs.push_back(merge);
+      const Operator* op =
+          marker->opcode() == IrOpcode::kLoopExitValue
+              ? common_->Phi(MachineRepresentation::kTagged, unroll_count)
+              : common_->EffectPhi(unroll_count);
+      Node* phi = graph_->NewNode(op, unroll_count + 1, &inputs[0]);
+      if (NodeProperties::IsTyped(marker)) {
+        NodeProperties::SetType(phi, NodeProperties::GetType(marker));
+      }
+      for (Edge edge : marker->use_edges()) {
+        if (edge.from() != phi) edge.UpdateTo(phi);
+      }
+    }
+  }
+}
+
+void LoopUnroller::UnrollInnerLoops(LoopTree::Loop* loop) {
+  // If the loop has nested loops, unroll inside those.
+  if (!loop->children().empty()) {
+    for (LoopTree::Loop* inner_loop : loop->children()) {
+      UnrollInnerLoops(inner_loop);
+    }
+    return;
+  }
+  int const unroll_count = UnrollCountFor(loop);
+  if (unroll_count < 2 || !CanUnroll(loop)) return;
+  if (FLAG_trace_turbo_loop) {
+    PrintF("Unrolling loop with header %i %i times\n",
+           loop_tree_->GetLoopControl(loop)->id(), unroll_count);
+  }
+
+  Unroll(loop, unroll_count);
+}
+
+void LoopUnroller::UnrollInnerLoopsOfTree() {
+  for (LoopTree::Loop* loop : loop_tree_->outer_loops()) {
+    UnrollInnerLoops(loop);
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,60 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOOP_UNROLLING_H_
+#define V8_COMPILER_LOOP_UNROLLING_H_
+
+#include "src/base/compiler-specific.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class CommonOperatorBuilder;
+class SourcePositionTable;
+
+// Implements loop unrolling. The body of an innermost loop is copied
+// {unroll_count - 1} times, and the copies are chained between the loop
+// header and the backedge. Each copy keeps its own exit condition, so no
+// trip count is needed; the benefit comes from fewer backedges and from
+// later phases (e.g. load elimination) seeing several iterations at once.
+class V8_EXPORT_PRIVATE LoopUnroller {
+ public:
+  LoopUnroller(Graph* graph, CommonOperatorBuilder* common,
+               LoopTree* loop_tree, Zone* tmp_zone,
+               SourcePositionTable* source_positions)
+      : graph_(graph),
+        common_(common),
+        loop_tree_(loop_tree),
+        tmp_zone_(tmp_zone),
+        source_positions_(source_positions) {}
+
+  bool CanUnroll(LoopTree::Loop* loop);
+  void Unroll(LoopTree::Loop* loop, int unroll_count);
+  void UnrollInnerLoopsOfTree();
+
+  // Returns how many iterations {loop} should be unrolled into, or 1 if it
+  // should be left alone.
+  static int UnrollCountFor(LoopTree::Loop* loop);
+
+  static const int kMaxUnrollCount = 4;
+  static const size_t kMaxUnrolledNodes = 200;
+
+ private:
+  Graph* const graph_;
+  CommonOperatorBuilder* const common_;
+  LoopTree* const loop_tree_;
+  Zone* const tmp_zone_;
+  SourcePositionTable* const source_positions_;
+
+  void UnrollInnerLoops(LoopTree::Loop* loop);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOOP_UNROLLING_H_
@@ -17,7 +17,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr,
+                                                bool tune_for_host) {
   UNIMPLEMENTED();
 }
 
@@ -20,13 +20,15 @@ class Zone;
 namespace compiler {
 
 // Forward declarations.
+class JSHeapBroker;
 class Operator;
 class Type;
 class TypeCache;
 
 class V8_EXPORT_PRIVATE OperationTyper {
  public:
-  OperationTyper(Isolate* isolate, Zone* zone);
+  OperationTyper(Isolate* isolate, const JSHeapBroker* js_heap_broker,
+                 Zone* zone);
 
   // Typing Phi.
   Type* Merge(Type* left, Type* right);
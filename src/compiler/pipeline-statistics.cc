@@ -87,6 +87,11 @@ void PipelineStatistics::EndPhaseKind() {
   compilation_stats_->RecordPhaseKindStats(phase_kind_name_, diff);
 }
 
+void PipelineStatistics::RecordCounter(const char* counter_name,
+                                       size_t value) {
+  compilation_stats_->RecordCounter(counter_name, value);
+}
+
 
 void PipelineStatistics::BeginPhase(const char* name) {
   DCHECK(InPhaseKind());
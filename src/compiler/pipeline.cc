@@ -35,6 +35,7 @@
 #include "src/compiler/js-context-specialization.h"
 #include "src/compiler/js-create-lowering.h"
 #include "src/compiler/js-generic-lowering.h"
+#include "src/compiler/js-heap-broker.h"
 #include "src/compiler/js-inlining-heuristic.h"
 #include "src/compiler/js-intrinsic-lowering.h"
 #include "src/compiler/js-native-context-specialization.h"
@@ -44,6 +45,7 @@
 #include "src/compiler/load-elimination.h"
 #include "src/compiler/loop-analysis.h"
 #include "src/compiler/loop-peeling.h"
+#include "src/compiler/loop-unrolling.h"
 #include "src/compiler/loop-variable-optimizer.h"
 #include "src/compiler/machine-graph-verifier.h"
 #include "src/compiler/machine-operator-reducer.h"
@@ -119,6 +121,7 @@ class PipelineData {
     javascript_ = new (graph_zone_) JSOperatorBuilder(graph_zone_);
     jsgraph_ = new (graph_zone_)
         JSGraph(isolate_, graph_, common_, javascript_, simplified_, machine_);
+    js_heap_broker_ = new (graph_zone_) JSHeapBroker(isolate_, graph_zone_);
   }
 
   // For WebAssembly compile entry point.
@@ -222,6 +225,7 @@ class PipelineData {
   CommonOperatorBuilder* common() const { return common_; }
   JSOperatorBuilder* javascript() const { return javascript_; }
   JSGraph* jsgraph() const { return jsgraph_; }
+  JSHeapBroker* js_heap_broker() const { return js_heap_broker_; }
   Handle<Context> native_context() const {
     return handle(info()->native_context(), isolate());
   }
@@ -273,6 +277,7 @@ class PipelineData {
     common_ = nullptr;
     javascript_ = nullptr;
     jsgraph_ = nullptr;
+    js_heap_broker_ = nullptr;
     schedule_ = nullptr;
   }
 
@@ -396,6 +401,7 @@ class PipelineData {
   CommonOperatorBuilder* common_ = nullptr;
   JSOperatorBuilder* javascript_ = nullptr;
   JSGraph* jsgraph_ = nullptr;
+  JSHeapBroker* js_heap_broker_ = nullptr;
   Schedule* schedule_ = nullptr;
 
   // All objects in the following group of fields are allocated in
@@ -824,6 +830,10 @@ PipelineCompilationJob::Status PipelineCompilationJob::PrepareJobImpl(
   data_.set_start_source_position(
       compilation_info()->shared_info()->StartPosition());
 
+  // Snapshot the heap objects that the typing phases ask about, so that the
+  // phases on the background thread do not have to read them.
+  data_.js_heap_broker()->SerializeStandardObjects();
+
   linkage_ = new (compilation_info()->zone()) Linkage(
       Linkage::ComputeIncoming(compilation_info()->zone(), compilation_info()));
 
@@ -1197,10 +1207,12 @@ struct TypedLoweringPhase {
                                               data->common(), temp_zone);
     JSCreateLowering create_lowering(
         &graph_reducer, data->info()->dependencies(), data->jsgraph(),
-        data->native_context(), temp_zone);
-    JSTypedLowering typed_lowering(&graph_reducer, data->jsgraph(), temp_zone);
+        data->js_heap_broker(), data->native_context(), temp_zone);
+    JSTypedLowering typed_lowering(&graph_reducer, data->jsgraph(),
+                                   data->js_heap_broker(), temp_zone);
     TypedOptimization typed_optimization(
-        &graph_reducer, data->info()->dependencies(), data->jsgraph());
+        &graph_reducer, data->info()->dependencies(), data->jsgraph(),
+        data->js_heap_broker());
     SimplifiedOperatorReducer simple_reducer(&graph_reducer, data->jsgraph());
     CheckpointElimination checkpoint_elimination(&graph_reducer);
     CommonOperatorReducer common_reducer(&graph_reducer, data->graph(),
@@ -1239,8 +1251,8 @@ struct SimplifiedLoweringPhase {
   static const char* phase_name() { return "simplified lowering"; }
 
   void Run(PipelineData* data, Zone* temp_zone) {
-    SimplifiedLowering lowering(data->jsgraph(), temp_zone,
-                                data->source_positions());
+    SimplifiedLowering lowering(data->jsgraph(), data->js_heap_broker(),
+                                temp_zone, data->source_positions());
     lowering.LowerAllNodes();
   }
 };
@@ -1262,6 +1274,23 @@ struct LoopPeelingPhase {
   }
 };
 
+struct LoopUnrollingPhase {
+  static const char* phase_name() { return "loop unrolling"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    GraphTrimmer trimmer(temp_zone, data->graph());
+    NodeVector roots(temp_zone);
+    data->jsgraph()->GetCachedNodes(&roots);
+    trimmer.TrimGraph(roots.begin(), roots.end());
+
+    LoopTree* loop_tree =
+        LoopFinder::BuildLoopTree(data->jsgraph()->graph(), temp_zone);
+    LoopUnroller(data->graph(), data->common(), loop_tree, temp_zone,
+                 data->source_positions())
+        .UnrollInnerLoopsOfTree();
+  }
+};
+
 struct LoopExitEliminationPhase {
   static const char* phase_name() { return "loop exit elimination"; }
 
@@ -1432,6 +1461,12 @@ struct LoadEliminationPhase {
     AddReducer(data, &graph_reducer, &common_reducer);
     AddReducer(data, &graph_reducer, &value_numbering);
     graph_reducer.ReduceGraph();
+
+    if (data->pipeline_statistics() != nullptr) {
+      data->pipeline_statistics()->RecordCounter(
+          "bounds checks eliminated",
+          branch_condition_elimination.eliminated_bounds_checks());
+    }
   }
 };
 
@@ -1614,6 +1649,20 @@ struct AllocateFPRegistersPhase {
 };
 
 
+struct SecondChanceAllocationPhase {
+  static const char* phase_name() { return "second chance allocation"; }
+
+  void Run(PipelineData* data, Zone* temp_zone) {
+    SecondChanceAllocator general(data->register_allocation_data(),
+                                  GENERAL_REGISTERS, temp_zone);
+    general.AllocateRegisters();
+    SecondChanceAllocator fp(data->register_allocation_data(), FP_REGISTERS,
+                             temp_zone);
+    fp.AllocateRegisters();
+  }
+};
+
+
 struct MergeSplintersPhase {
   static const char* phase_name() { return "merge splintered ranges"; }
   void Run(PipelineData* pipeline_data, Zone* temp_zone) {
@@ -1849,7 +1898,7 @@ bool PipelineImpl::CreateGraph() {
     // Type the graph and keep the Typer running on newly created nodes within
     // this scope; the Typer is automatically unlinked from the Graph once we
     // leave this scope below.
-    Typer typer(isolate(), flags, data->graph());
+    Typer typer(isolate(), data->js_heap_broker(), flags, data->graph());
     Run<TyperPhase>(&typer);
     RunPrintAndVerify("Typed");
 
@@ -1873,6 +1922,11 @@ bool PipelineImpl::OptimizeGraph(Linkage* linkage) {
   data->BeginPhaseKind("lowering");
 
   if (data->info()->is_loop_peeling_enabled()) {
+    // Unrolling relies on the loop exit markers, which peeling removes.
+    if (FLAG_turbo_loop_unrolling) {
+      Run<LoopUnrollingPhase>();
+      RunPrintAndVerify("Loops unrolled", true);
+    }
     Run<LoopPeelingPhase>();
     RunPrintAndVerify("Loops peeled", true);
   } else {
@@ -2334,6 +2388,15 @@ void PipelineImpl::AllocateRegisters(const RegisterConfiguration* config,
     Run<MergeSplintersPhase>();
   }
 
+  // Large functions are where linear scan spills the most, and they are hot
+  // by the time they get here, so spend some more compile time on them.
+  if (FLAG_turbo_second_chance_allocation &&
+      data->sequence()->instructions().size() >=
+          static_cast<size_t>(
+              FLAG_turbo_second_chance_allocation_min_instructions)) {
+    Run<SecondChanceAllocationPhase>();
+  }
+
   Run<AssignSpillSlotsPhase>();
 
   Run<CommitAssignmentPhase>();
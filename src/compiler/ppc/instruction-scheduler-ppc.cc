@@ -144,7 +144,8 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr,
+                                                bool tune_for_host) {
   // TODO(all): Add instruction cost modeling.
   return 1;
 }
@@ -464,6 +464,12 @@ void LiveRange::Spill() {
 }
 
 
+void LiveRange::Unspill() {
+  DCHECK(spilled());
+  set_spilled(false);
+}
+
+
 RegisterKind LiveRange::kind() const {
   return IsFloatingPoint(representation()) ? FP_REGISTERS : GENERAL_REGISTERS;
 }
@@ -3517,6 +3523,161 @@ void LinearScanAllocator::SpillBetweenUntil(LiveRange* range,
 }
 
 
+static bool OccupantSortHelper(LiveRange* a, LiveRange* b) {
+  return a->Start() < b->Start();
+}
+
+
+SecondChanceAllocator::SecondChanceAllocator(RegisterAllocationData* data,
+                                             RegisterKind kind,
+                                             Zone* local_zone)
+    : RegisterAllocator(data, kind),
+      occupants_(num_registers(), ZoneVector<LiveRange*>(local_zone),
+                 local_zone),
+      local_zone_(local_zone) {}
+
+
+void SecondChanceAllocator::AllocateRegisters() {
+  // With complex aliasing a float register overlaps several others; keep
+  // this pass simple and leave those functions to linear scan alone.
+  if (check_fp_aliasing()) return;
+
+  const ZoneVector<TopLevelLiveRange*>& fixed_ranges =
+      mode() == GENERAL_REGISTERS ? data()->fixed_live_ranges()
+                                  : data()->fixed_double_live_ranges();
+  for (TopLevelLiveRange* range : fixed_ranges) {
+    if (range == nullptr) continue;
+    occupants_[range->assigned_register()].push_back(range);
+  }
+
+  ZoneVector<LiveRange*> candidates(local_zone_);
+  for (TopLevelLiveRange* top : data()->live_ranges()) {
+    if (!CanProcessRange(top)) continue;
+    for (LiveRange* range = top; range != nullptr; range = range->next()) {
+      if (range->HasRegisterAssigned()) {
+        occupants_[range->assigned_register()].push_back(range);
+      } else if (IsCandidate(range)) {
+        candidates.push_back(range);
+      }
+    }
+  }
+  for (ZoneVector<LiveRange*>& occupants : occupants_) {
+    std::sort(occupants.begin(), occupants.end(), &OccupantSortHelper);
+  }
+
+  for (LiveRange* range : candidates) {
+    LifetimePosition from = range->Start();
+    int reg = FindFreeRegister(range, from);
+    if (reg == kUnassignedRegister) {
+      // Linear scan spilled the range where all registers were taken, but the
+      // pressure may drop later on. Try to keep the part from the first use
+      // that benefits from a register in a register, and reload it there.
+      UsePosition* use =
+          range->NextUsePositionRegisterIsBeneficial(range->Start());
+      from = use->pos().PrevStart().End();
+      if (data()->IsBlockBoundary(use->pos().Start())) {
+        from = use->pos().Start();
+      }
+      if (from <= range->Start()) continue;
+      const InstructionBlock* block =
+          code()->GetInstructionBlock(from.ToInstructionIndex());
+      if (block->IsDeferred()) continue;
+      reg = FindFreeRegister(range, from);
+      if (reg == kUnassignedRegister) continue;
+      range = SplitRangeAt(range, from);
+    } else {
+      range->Unspill();
+    }
+
+    TRACE("Second chance: assigning %s to live range %d:%d\n",
+          RegisterName(reg), range->TopLevel()->vreg(), range->relative_id());
+    range->set_assigned_register(reg);
+    data()->MarkAllocated(range->representation(), reg);
+    AddOccupant(range);
+  }
+}
+
+
+bool SecondChanceAllocator::IsCandidate(LiveRange* range) const {
+  if (!range->spilled()) return false;
+  TopLevelLiveRange* top = range->TopLevel();
+  // The top level range holds the definition; keep it where linear scan
+  // put it. Ranges that are spilled only in deferred blocks get their spill
+  // moves from the connector, which expects the spilled children to stay.
+  if (range == top || top->IsSpilledOnlyInDeferredBlocks()) return false;
+  // A register only pays off if some use in the range benefits from it, and
+  // deferred code is not worth the effort.
+  if (range->NextUsePositionRegisterIsBeneficial(range->Start()) == nullptr) {
+    return false;
+  }
+  const InstructionBlock* block =
+      code()->GetInstructionBlock(range->Start().ToInstructionIndex());
+  return !block->IsDeferred();
+}
+
+
+int SecondChanceAllocator::FindFreeRegister(LiveRange* range,
+                                            LifetimePosition from) const {
+  // Prefer the registers of the neighbouring children, which saves the
+  // move that connects them.
+  int hints[2] = {kUnassignedRegister, kUnassignedRegister};
+  for (LiveRange* child = range->TopLevel(); child != nullptr;
+       child = child->next()) {
+    if (child->next() == range && child->End() == from) {
+      hints[0] = child->assigned_register();
+    }
+    if (child == range && child->next() != nullptr &&
+        child->next()->Start() == range->End()) {
+      hints[1] = child->next()->assigned_register();
+    }
+  }
+
+  for (int hint : hints) {
+    if (hint != kUnassignedRegister && IsFreeFor(hint, range, from)) {
+      return hint;
+    }
+  }
+  for (int i = 0; i < num_allocatable_registers(); ++i) {
+    int code = allocatable_register_codes()[i];
+    if (IsFreeFor(code, range, from)) return code;
+  }
+  return kUnassignedRegister;
+}
+
+
+bool SecondChanceAllocator::IsFreeFor(int reg, LiveRange* range,
+                                      LifetimePosition from) const {
+  // The occupants are sorted by start, so none of the remaining ones can
+  // intersect once one starts after the range ends.
+  for (LiveRange* occupant : occupants_[reg]) {
+    if (range->End() <= occupant->Start()) break;
+    if (occupant->End() <= from) continue;
+    // Look for a position at or after {from} where both are live.
+    UseInterval* a = occupant->first_interval();
+    UseInterval* b = range->first_interval();
+    while (a != nullptr && b != nullptr) {
+      LifetimePosition start = Max(Max(a->start(), b->start()), from);
+      if (start < a->end() && start < b->end()) return false;
+      if (a->end() < b->end()) {
+        a = a->next();
+      } else {
+        b = b->next();
+      }
+    }
+  }
+  return true;
+}
+
+
+void SecondChanceAllocator::AddOccupant(LiveRange* range) {
+  DCHECK(range->HasRegisterAssigned());
+  ZoneVector<LiveRange*>& occupants = occupants_[range->assigned_register()];
+  occupants.insert(std::upper_bound(occupants.begin(), occupants.end(), range,
+                                    &OccupantSortHelper),
+                   range);
+}
+
+
 SpillSlotLocator::SpillSlotLocator(RegisterAllocationData* data)
     : data_(data) {}
 
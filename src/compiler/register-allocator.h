@@ -342,6 +342,9 @@ class V8_EXPORT_PRIVATE LiveRange : public NON_EXPORTED_BASE(ZoneObject) {
 
   bool spilled() const { return SpilledField::decode(bits_); }
   void Spill();
+  // Undoes Spill(). The top level range keeps its spill range, so that the
+  // spill at definition and the safepoint information stay valid.
+  void Unspill();
 
   RegisterKind kind() const;
 
@@ -1118,6 +1121,37 @@ class LinearScanAllocator final : public RegisterAllocator {
 };
 
 
+// Linear scan never revisits a range once it has been spilled, even if the
+// register pressure that caused the spill goes away later. This pass runs
+// after linear scan and gives spilled child ranges a second chance: a range
+// with uses that benefit from a register is moved into any register that is
+// free for its whole lifetime, preferring the register of an adjacent child
+// so that no move is needed. Otherwise the range is split before its first
+// such use, and the rest is moved into a register if one is free from there.
+class SecondChanceAllocator final : public RegisterAllocator {
+ public:
+  SecondChanceAllocator(RegisterAllocationData* data, RegisterKind kind,
+                        Zone* local_zone);
+
+  void AllocateRegisters();
+
+ private:
+  bool IsCandidate(LiveRange* range) const;
+  // Returns a register that no other live range holds from {from} up to the
+  // end of {range}, or kUnassignedRegister.
+  int FindFreeRegister(LiveRange* range, LifetimePosition from) const;
+  bool IsFreeFor(int reg, LiveRange* range, LifetimePosition from) const;
+  void AddOccupant(LiveRange* range);
+
+  // The live ranges that hold each register, indexed by register code and
+  // sorted by start.
+  ZoneVector<ZoneVector<LiveRange*>> occupants_;
+  Zone* const local_zone_;
+
+  DISALLOW_COPY_AND_ASSIGN(SecondChanceAllocator);
+};
+
+
 class SpillSlotLocator final : public ZoneObject {
  public:
   explicit SpillSlotLocator(RegisterAllocationData* data);
@@ -15,6 +15,7 @@ namespace internal {
 namespace compiler {
 
 // Forward declarations.
+class JSHeapBroker;
 class RepresentationChanger;
 class RepresentationSelector;
 class SourcePositionTable;
@@ -22,8 +23,8 @@ class TypeCache;
 
 class V8_EXPORT_PRIVATE SimplifiedLowering final {
  public:
-  SimplifiedLowering(JSGraph* jsgraph, Zone* zone,
-                     SourcePositionTable* source_positions);
+  SimplifiedLowering(JSGraph* jsgraph, const JSHeapBroker* js_heap_broker,
+                     Zone* zone, SourcePositionTable* source_positions);
   ~SimplifiedLowering() {}
 
   void LowerAllNodes();
@@ -45,6 +46,7 @@ class V8_EXPORT_PRIVATE SimplifiedLowering final {
 
  private:
   JSGraph* const jsgraph_;
+  const JSHeapBroker* const js_heap_broker_;
   Zone* const zone_;
   TypeCache const& type_cache_;
   SetOncePointer<Node> to_number_code_;
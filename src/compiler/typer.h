@@ -25,7 +25,8 @@ class V8_EXPORT_PRIVATE Typer {
   };
   typedef base::Flags<Flag> Flags;
 
-  Typer(Isolate* isolate, Flags flags, Graph* graph);
+  Typer(Isolate* isolate, const JSHeapBroker* js_heap_broker, Flags flags,
+        Graph* graph);
   ~Typer();
 
   void Run();
@@ -42,10 +43,12 @@ class V8_EXPORT_PRIVATE Typer {
   Zone* zone() const { return graph()->zone(); }
   Isolate* isolate() const { return isolate_; }
   OperationTyper* operation_typer() { return &operation_typer_; }
+  const JSHeapBroker* js_heap_broker() const { return js_heap_broker_; }
 
   Isolate* const isolate_;
   Flags const flags_;
   Graph* const graph_;
+  const JSHeapBroker* const js_heap_broker_;
   Decorator* decorator_;
   TypeCache const& cache_;
   OperationTyper operation_typer_;
@@ -6,6 +6,7 @@
 #define V8_COMPILER_TYPES_H_
 
 #include "src/base/compiler-specific.h"
+#include "src/compiler/js-heap-broker.h"
 #include "src/conversions.h"
 #include "src/globals.h"
 #include "src/handles.h"
@@ -254,6 +255,7 @@ class V8_EXPORT_PRIVATE BitsetType {
   static double Max(bitset);
 
   static bitset Glb(double min, double max);
+  static bitset Lub(HeapObjectType const& type);
   static bitset Lub(i::Map* map);
   static bitset Lub(i::Object* value);
   static bitset Lub(double value);
@@ -364,14 +366,16 @@ class V8_EXPORT_PRIVATE Type {
   }
 
   static Type* OtherNumberConstant(double value, Zone* zone);
-  static Type* HeapConstant(i::Handle<i::HeapObject> value, Zone* zone);
+  static Type* HeapConstant(const JSHeapBroker* js_heap_broker,
+                            i::Handle<i::HeapObject> value, Zone* zone);
   static Type* Range(double min, double max, Zone* zone);
   static Type* Range(RangeType::Limits lims, Zone* zone);
   static Type* Tuple(Type* first, Type* second, Type* third, Zone* zone);
   static Type* Union(int length, Zone* zone);
 
   // NewConstant is a factory that returns Constant, Range or Number.
-  static Type* NewConstant(i::Handle<i::Object> value, Zone* zone);
+  static Type* NewConstant(const JSHeapBroker* js_heap_broker,
+                           i::Handle<i::Object> value, Zone* zone);
   static Type* NewConstant(double value, Zone* zone);
 
   static Type* Union(Type* type1, Type* type2, Zone* zone);
@@ -540,8 +544,10 @@ class V8_EXPORT_PRIVATE HeapConstantType : public NON_EXPORTED_BASE(TypeBase) {
   friend class Type;
   friend class BitsetType;
 
-  static HeapConstantType* New(i::Handle<i::HeapObject> value, Zone* zone) {
-    BitsetType::bitset bitset = BitsetType::Lub(*value);
+  static HeapConstantType* New(const JSHeapBroker* js_heap_broker,
+                               i::Handle<i::HeapObject> value, Zone* zone) {
+    BitsetType::bitset bitset =
+        BitsetType::Lub(js_heap_broker->HeapObjectTypeOf(value));
     return new (zone->New(sizeof(HeapConstantType)))
         HeapConstantType(bitset, value);
   }
@@ -4,6 +4,11 @@
 
 #include "src/compiler/instruction-scheduler.h"
 
+#include <cstring>
+
+#include "src/base/cpu.h"
+#include "src/base/once.h"
+
 namespace v8 {
 namespace internal {
 namespace compiler {
@@ -318,16 +323,103 @@ int InstructionScheduler::GetTargetInstructionFlags(
 }
 
 
-int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
-  // Basic latency modeling for x64 instructions. They have been determined
-  // in an empirical way.
+namespace {
+
+// Latency classes of the x64 instructions that take more than one cycle.
+enum LatencyClass {
+  kIntMul,
+  kFloatAdd,  // Also compare, abs, neg, min and max.
+  kFloat32Mul,
+  kFloat64Mul,
+  kFloatConvert,  // Float32/Float64 conversions, rounding and to (u)int32.
+  kFloatToInt64,
+  kFloatDiv,
+  kFloatSqrt,
+  kFloat64Mod,
+  kIdiv,
+  kIdiv32,
+  kUdiv,
+  kUdiv32,
+  kTruncateDoubleToI,
+  kLatencyClassCount
+};
+
+enum Microarchitecture {
+  kGeneric,
+  kHaswell,  // Also Broadwell.
+  kSkylake,  // Also Kaby Lake and Coffee Lake.
+  kZen,
+  kMicroarchitectureCount
+};
+
+// Latencies in cycles for register operands, per microarchitecture. The
+// generic column is the empirically determined model used so far; the others
+// follow published measurements, rounded to the common case (e.g. divisions
+// are listed with their latency for small operands).
+const int kLatencies[kMicroarchitectureCount][kLatencyClassCount] = {
+    // Mul, FAdd, F32Mul, F64Mul, FConv, FToI64, FDiv, FSqrt, FMod,
+    // Idiv, Idiv32, Udiv, Udiv32, TruncateDoubleToI
+    {3, 3, 4, 5, 4, 10, 13, 13, 50, 49, 35, 38, 26, 6},  // kGeneric
+    {3, 3, 5, 5, 5, 8, 14, 16, 50, 40, 22, 32, 22, 6},   // kHaswell
+    {3, 4, 4, 4, 5, 8, 14, 18, 50, 42, 26, 35, 26, 6},   // kSkylake
+    {3, 3, 3, 4, 4, 7, 13, 20, 50, 45, 29, 45, 29, 5},   // kZen
+};
+
+Microarchitecture DetectMicroarchitecture() {
+  base::CPU cpu;
+  if (strcmp(cpu.vendor(), "GenuineIntel") == 0 && cpu.family() == 6 &&
+      !cpu.is_atom()) {
+    switch (cpu.model()) {
+      case 0x3C:  // Haswell.
+      case 0x3F:
+      case 0x45:
+      case 0x46:
+      case 0x3D:  // Broadwell.
+      case 0x47:
+      case 0x4F:
+      case 0x56:
+        return kHaswell;
+      case 0x4E:  // Skylake.
+      case 0x5E:
+      case 0x55:
+      case 0x8E:  // Kaby Lake and Coffee Lake.
+      case 0x9E:
+        return kSkylake;
+      default:
+        break;
+    }
+  } else if (strcmp(cpu.vendor(), "AuthenticAMD") == 0 &&
+             cpu.family() == 0x17) {
+    return kZen;
+  }
+  return kGeneric;
+}
+
+base::OnceType init_host_latencies_once = V8_ONCE_INIT;
+const int* host_latencies = nullptr;
+
+void InitHostLatencies() {
+  host_latencies = kLatencies[DetectMicroarchitecture()];
+}
+
+const int* GetLatencies(bool tune_for_host) {
+  if (!tune_for_host) return kLatencies[kGeneric];
+  base::CallOnce(&init_host_latencies_once, &InitHostLatencies);
+  return host_latencies;
+}
+
+}  // namespace
+
+int InstructionScheduler::GetInstructionLatency(const Instruction* instr,
+                                                bool tune_for_host) {
+  // The microarchitecture of the host CPU is detected on first use.
+  const int* latencies = GetLatencies(tune_for_host);
   switch (instr->arch_opcode()) {
-    case kSSEFloat64Mul:
-      return 5;
     case kX64Imul:
     case kX64Imul32:
     case kX64ImulHigh32:
     case kX64UmulHigh32:
+      return latencies[kIntMul];
     case kSSEFloat32Cmp:
     case kSSEFloat32Add:
     case kSSEFloat32Sub:
@@ -340,8 +432,11 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat64Min:
     case kSSEFloat64Abs:
     case kSSEFloat64Neg:
-      return 3;
+      return latencies[kFloatAdd];
     case kSSEFloat32Mul:
+      return latencies[kFloat32Mul];
+    case kSSEFloat64Mul:
+      return latencies[kFloat64Mul];
     case kSSEFloat32ToFloat64:
     case kSSEFloat64ToFloat32:
     case kSSEFloat32Round:
@@ -350,29 +445,30 @@ int InstructionScheduler::GetInstructionLatency(const Instruction* instr) {
     case kSSEFloat32ToUint32:
     case kSSEFloat64ToInt32:
     case kSSEFloat64ToUint32:
-      return 4;
+      return latencies[kFloatConvert];
     case kX64Idiv:
-      return 49;
+      return latencies[kIdiv];
     case kX64Idiv32:
-      return 35;
+      return latencies[kIdiv32];
     case kX64Udiv:
-      return 38;
+      return latencies[kUdiv];
     case kX64Udiv32:
-      return 26;
+      return latencies[kUdiv32];
     case kSSEFloat32Div:
     case kSSEFloat64Div:
+      return latencies[kFloatDiv];
     case kSSEFloat32Sqrt:
     case kSSEFloat64Sqrt:
-      return 13;
+      return latencies[kFloatSqrt];
     case kSSEFloat32ToInt64:
     case kSSEFloat64ToInt64:
     case kSSEFloat32ToUint64:
     case kSSEFloat64ToUint64:
-      return 10;
+      return latencies[kFloatToInt64];
     case kSSEFloat64Mod:
-      return 50;
+      return latencies[kFloat64Mod];
     case kArchTruncateDoubleToI:
-      return 6;
+      return latencies[kTruncateDoubleToI];
     default:
       return 1;
   }
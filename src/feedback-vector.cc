@@ -173,6 +173,24 @@ const char* FeedbackMetadata::Kind2String(FeedbackSlotKind kind) {
   UNREACHABLE();
 }
 
+int FeedbackMetadata::PretenuringHintOffset(FeedbackSlot slot) const {
+  return kHeaderSize + (length() + slot.ToInt() / kBitsPerInt) * kInt32Size;
+}
+
+bool FeedbackMetadata::HasPretenuringHint(FeedbackSlot slot) const {
+  DCHECK_EQ(FeedbackSlotKind::kLiteral, GetKind(slot));
+  uint32_t bits = READ_UINT32_FIELD(this, PretenuringHintOffset(slot));
+  return (bits & (1u << (slot.ToInt() % kBitsPerInt))) != 0;
+}
+
+void FeedbackMetadata::SetPretenuringHint(FeedbackSlot slot, bool hint) {
+  DCHECK_EQ(FeedbackSlotKind::kLiteral, GetKind(slot));
+  int offset = PretenuringHintOffset(slot);
+  uint32_t bit = 1u << (slot.ToInt() % kBitsPerInt);
+  uint32_t bits = READ_UINT32_FIELD(this, offset);
+  WRITE_UINT32_FIELD(this, offset, hint ? (bits | bit) : (bits & ~bit));
+}
+
 bool FeedbackMetadata::HasTypeProfileSlot() const {
   FeedbackSlot slot =
       FeedbackVector::ToSlot(FeedbackVectorSpec::kTypeProfileSlotIndex);
@@ -375,6 +393,20 @@ bool FeedbackVector::ClearSlots(Isolate* isolate) {
   return feedback_updated;
 }
 
+void FeedbackVector::RecordPretenuringHints() {
+  FeedbackMetadata* metadata = this->metadata();
+  FeedbackMetadataIterator iter(metadata);
+  while (iter.HasNext()) {
+    FeedbackSlot slot = iter.Next();
+    if (iter.kind() != FeedbackSlotKind::kLiteral) continue;
+    // Slots without a site keep a hint that has not been consumed yet.
+    Object* feedback = Get(slot);
+    if (!feedback->IsAllocationSite()) continue;
+    metadata->SetPretenuringHint(
+        slot, AllocationSite::cast(feedback)->GetPretenureMode() == TENURED);
+  }
+}
+
 Handle<FixedArray> FeedbackNexus::EnsureArrayOfSize(int length) {
   Isolate* isolate = GetIsolate();
   Handle<Object> feedback = handle(GetFeedback(), isolate);
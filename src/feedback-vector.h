@@ -255,6 +255,10 @@ class FeedbackVector : public HeapObject {
   // Clears the vector slots. Return true if feedback has changed.
   bool ClearSlots(Isolate* isolate);
 
+  // Updates the pretenuring hints in the metadata from the current decisions
+  // of the literal allocation sites in this vector.
+  void RecordPretenuringHints();
+
   // The object that indicates an uninitialized cache.
   static inline Handle<Symbol> UninitializedSentinel(Isolate* isolate);
 
@@ -438,6 +442,13 @@ class FeedbackMetadata : public HeapObject {
   // Returns slot kind for given slot.
   FeedbackSlotKind GetKind(FeedbackSlot slot) const;
 
+  // Pretenuring hints mark literal slots whose allocation site was tenured
+  // when the function was last optimized. They are carried to other
+  // processes by the code serializer and seed the allocation sites created
+  // there.
+  bool HasPretenuringHint(FeedbackSlot slot) const;
+  void SetPretenuringHint(FeedbackSlot slot, bool hint);
+
   // If {spec} is null, then it is considered empty.
   V8_EXPORT_PRIVATE static Handle<FeedbackMetadata> New(
       Isolate* isolate, const FeedbackVectorSpec* spec = nullptr);
@@ -457,7 +468,9 @@ class FeedbackMetadata : public HeapObject {
   // This includes any necessary padding at the end of the object for pointer
   // size alignment.
   static int SizeFor(int slot_count) {
-    return OBJECT_POINTER_ALIGN(kHeaderSize + length(slot_count) * kInt32Size);
+    return OBJECT_POINTER_ALIGN(
+        kHeaderSize +
+        (length(slot_count) + hints_length(slot_count)) * kInt32Size);
   }
 
   static const int kSlotCountOffset = HeapObject::kHeaderSize;
@@ -481,6 +494,13 @@ class FeedbackMetadata : public HeapObject {
   }
   inline int length() const;
 
+  // The number of int32 data fields holding one pretenuring hint bit per slot.
+  // They follow the encoded slot kinds.
+  static int hints_length(int slot_count) {
+    return (slot_count + kBitsPerInt - 1) / kBitsPerInt;
+  }
+  int PretenuringHintOffset(FeedbackSlot slot) const;
+
   static const int kFeedbackSlotKindBits = 5;
   STATIC_ASSERT(static_cast<int>(FeedbackSlotKind::kKindsNumber) <
                 (1 << kFeedbackSlotKindBits));
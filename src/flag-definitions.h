@@ -290,9 +290,15 @@ DEFINE_IMPLICATION(future, write_protect_code_memory)
 // Flags for experimental implementation features.
 DEFINE_BOOL(allocation_site_pretenuring, true,
             "pretenure with allocation sites")
+DEFINE_BOOL(code_cache_pretenuring_hints, true,
+            "carry pretenuring decisions of literal allocation sites in the "
+            "code cache")
 DEFINE_BOOL(page_promotion, true, "promote pages based on utilization")
 DEFINE_INT(page_promotion_threshold, 70,
            "min percentage of live bytes on a page to enable fast evacuation")
+DEFINE_BOOL(young_generation_large_objects, false,
+            "allocates large objects by default in the young generation large "
+            "object space")
 DEFINE_BOOL(trace_pretenuring, false,
             "trace pretenuring decisions of HAllocate instructions")
 DEFINE_BOOL(trace_pretenuring_statistics, false,
@@ -395,6 +401,12 @@ DEFINE_BOOL(turbo_sp_frame_access, false,
             "use stack pointer-relative access to frame wherever possible")
 DEFINE_BOOL(turbo_preprocess_ranges, true,
             "run pre-register allocation heuristics")
+DEFINE_BOOL(turbo_second_chance_allocation, false,
+            "after linear scan, move spilled live ranges into registers that "
+            "are free for their whole lifetime")
+DEFINE_INT(turbo_second_chance_allocation_min_instructions, 1000,
+           "minimum number of instructions for a function to get second "
+           "chance register allocation")
 DEFINE_STRING(turbo_filter, "*", "optimization filter for TurboFan compiler")
 DEFINE_BOOL(trace_turbo, false, "trace generated TurboFan IR")
 DEFINE_BOOL(trace_turbo_graph, false, "trace generated TurboFan graphs")
@@ -475,7 +487,11 @@ DEFINE_BOOL(turbo_verify_allocation, DEBUG_BOOL,
             "verify register allocation in TurboFan")
 DEFINE_BOOL(turbo_move_optimization, true, "optimize gap moves in TurboFan")
 DEFINE_BOOL(turbo_jt, true, "enable jump threading in TurboFan")
+DEFINE_BOOL(turbo_bounds_check_elimination, true,
+            "eliminate bounds checks dominated by an index < length branch")
 DEFINE_BOOL(turbo_loop_peeling, true, "Turbofan loop peeling")
+DEFINE_BOOL(turbo_loop_unrolling, false,
+            "Turbofan unrolling of small innermost loops")
 DEFINE_BOOL(turbo_loop_variable, true, "Turbofan loop variable optimization")
 DEFINE_BOOL(turbo_cf_optimization, true, "optimize control flow in TurboFan")
 DEFINE_BOOL(turbo_escape, true, "enable escape analysis")
@@ -691,11 +707,30 @@ DEFINE_BOOL(concurrent_marking, V8_CONCURRENT_MARKING_BOOL,
             "use concurrent marking")
 DEFINE_BOOL(parallel_marking, true, "use parallel marking in atomic pause")
 DEFINE_IMPLICATION(parallel_marking, concurrent_marking)
+DEFINE_BOOL(parallel_root_marking, false,
+            "mark global handles, eternal handles, the compilation cache and "
+            "builtins on parallel tasks in atomic pause")
+DEFINE_BOOL(concurrent_weak_collection_marking, false,
+            "visit weak collections on concurrent marking threads instead of "
+            "bailing out to the main thread")
+DEFINE_INT(ephemeron_fixpoint_iterations, 10,
+           "number of fixpoint iterations after which ephemeron marking "
+           "switches to the linear algorithm")
 DEFINE_BOOL(trace_concurrent_marking, false, "trace concurrent marking")
+DEFINE_BOOL(concurrent_embedder_tracing, true,
+            "trace embedder wrappers on concurrent marking threads if the "
+            "embedder supports it")
 DEFINE_BOOL(black_allocation, true, "use black allocation")
 DEFINE_BOOL(concurrent_store_buffer, true,
             "use concurrent store buffer processing")
+DEFINE_BOOL(concurrent_remembered_set_compaction, false,
+            "free empty old-to-new remembered set buckets of swept pages on a "
+            "background thread after young generation GCs")
 DEFINE_BOOL(concurrent_sweeping, true, "use concurrent sweeping")
+DEFINE_BOOL(concurrent_code_space_sweeping, false,
+            "sweep code space on the concurrent sweeper tasks instead of "
+            "incrementally on the main thread (only takes effect with "
+            "--no-write-protect-code-memory)")
 DEFINE_BOOL(parallel_compaction, true, "use parallel compaction")
 DEFINE_BOOL(parallel_pointer_update, true,
             "use parallel pointer update during compaction")
@@ -714,7 +749,16 @@ DEFINE_BOOL(track_retaining_path, false,
             "enable support for tracking retaining path")
 DEFINE_BOOL(concurrent_array_buffer_freeing, true,
             "free array buffer allocations on a background thread")
+DEFINE_INT(array_buffer_pool_size, 0,
+           "maximum size of the pool recycling array buffer backing stores "
+           "(in MBytes), 0 disables the pool")
+DEFINE_INT(array_buffer_pool_max_length, 64,
+           "maximum length of array buffer backing stores kept in the pool "
+           "(in KBytes)")
 DEFINE_INT(gc_stats, 0, "Used by tracing internally to enable gc statistics")
+DEFINE_INT(object_stats_sampling_rate, 0,
+           "collect object statistics on every n-th page at each mark-compact "
+           "(0 disables sampling)")
 DEFINE_IMPLICATION(trace_gc_object_stats, track_gc_object_stats)
 DEFINE_VALUE_IMPLICATION(track_gc_object_stats, gc_stats, 1)
 DEFINE_VALUE_IMPLICATION(trace_gc_object_stats, gc_stats, 1)
@@ -734,13 +778,23 @@ DEFINE_BOOL(verify_heap_skip_remembered_set, false,
 #endif
 DEFINE_BOOL(move_object_start, true, "enable moving of object starts")
 DEFINE_BOOL(memory_reducer, true, "use memory reducer")
+DEFINE_BOOL(predictive_memory_reducer, false,
+            "let the memory reducer forecast the allocation rate to anticipate "
+            "quiet periods")
 DEFINE_INT(heap_growing_percent, 0,
            "specifies heap growing factor as (1 + heap_growing_percent/100)")
 DEFINE_INT(v8_os_page_size, 0, "override OS page size (in KBytes)")
+DEFINE_BOOL(numa_aware_page_allocation, false,
+            "back heap pages with memory of the NUMA node of the allocating "
+            "thread and prefer pooled pages of that node")
 DEFINE_BOOL(always_compact, false, "Perform compaction on every full GC")
 DEFINE_BOOL(never_compact, false,
             "Never perform compaction on full GC - testing only")
 DEFINE_BOOL(compact_code_space, true, "Compact code space on full collections")
+DEFINE_INT(compaction_pause_target_ms, 0,
+           "limit the live bytes evacuated in latency critical full GCs to "
+           "what the measured evacuation speed, including pointer updating, "
+           "can move in the given time (0 means use the default limit)")
 DEFINE_BOOL(use_marking_progress_bar, true,
             "Use a progress bar to scan large objects in increments when "
             "incremental marking is active.")
@@ -1351,9 +1405,12 @@ DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_sweeping)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_compaction)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_marking)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_root_marking)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_weak_collection_marking)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_pointer_update)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, parallel_scavenge)
 DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_store_buffer)
+DEFINE_NEG_IMPLICATION(single_threaded_gc, concurrent_remembered_set_compaction)
 #ifdef ENABLE_MINOR_MC
 DEFINE_NEG_IMPLICATION(single_threaded_gc, minor_mc_parallel_marking)
 #endif  // ENABLE_MINOR_MC
@@ -929,6 +929,36 @@ void GlobalHandles::IterateStrongRoots(RootVisitor* v) {
   }
 }
 
+std::vector<GlobalHandles::UsedNodeBlockRange>
+GlobalHandles::PartitionUsedNodeBlocks(size_t blocks_per_range) {
+  DCHECK_LT(0, blocks_per_range);
+  std::vector<UsedNodeBlockRange> ranges;
+  for (NodeBlock* block = first_used_block_; block != nullptr;
+       block = block->next_used()) {
+    if (ranges.empty() || ranges.back().count == blocks_per_range) {
+      ranges.push_back({block, 0});
+    }
+    ranges.back().count++;
+  }
+  return ranges;
+}
+
+void GlobalHandles::IterateStrongRoots(RootVisitor* v,
+                                       const UsedNodeBlockRange& range) {
+  NodeBlock* block = range.first;
+  for (size_t index = 0; index < range.count; index++) {
+    DCHECK_NOT_NULL(block);
+    for (int i = 0; i < NodeBlock::kSize; i++) {
+      Node* node = block->node_at(i);
+      if (node->IsStrongRetainer()) {
+        v->VisitRootPointer(Root::kGlobalHandles, node->label(),
+                            node->location());
+      }
+    }
+    block = block->next_used();
+  }
+}
+
 void GlobalHandles::IterateWeakRoots(RootVisitor* v) {
   for (NodeIterator it(this); !it.done(); it.Advance()) {
     if (it.node()->IsWeak()) {
@@ -112,6 +112,18 @@ class GlobalHandles {
 
   void IterateStrongRoots(RootVisitor* v);
 
+  // A range of consecutive used node blocks. Allows partitioning the strong
+  // roots across parallel tasks while the set of used blocks does not change.
+  struct UsedNodeBlockRange;
+
+  // Splits the used node blocks into ranges of at most |blocks_per_range|
+  // blocks in a single pass over the list of used blocks.
+  std::vector<UsedNodeBlockRange> PartitionUsedNodeBlocks(
+      size_t blocks_per_range);
+
+  // Iterates over strong handles in the given range of used node blocks.
+  void IterateStrongRoots(RootVisitor* v, const UsedNodeBlockRange& range);
+
   void IterateWeakRoots(RootVisitor* v);
 
   void IterateAllRoots(RootVisitor* v);
@@ -224,6 +236,12 @@ class GlobalHandles {
 };
 
 
+struct GlobalHandles::UsedNodeBlockRange {
+  NodeBlock* first;
+  size_t count;
+};
+
+
 class GlobalHandles::PendingPhantomCallback {
  public:
   typedef v8::WeakCallbackInfo<void> Data;
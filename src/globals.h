@@ -492,6 +492,7 @@ class Map;
 class MapSpace;
 class MarkCompactCollector;
 class MaybeObject;
+class NewLargeObjectSpace;
 class NewSpace;
 class Object;
 class OldSpace;
@@ -532,9 +533,10 @@ enum AllocationSpace {
   CODE_SPACE,  // No pointers to new space, marked executable.
   MAP_SPACE,   // Only and all map objects.
   LO_SPACE,    // Promoted large objects.
+  NEW_LO_SPACE,  // Young generation large objects.
 
   FIRST_SPACE = RO_SPACE,
-  LAST_SPACE = LO_SPACE,
+  LAST_SPACE = NEW_LO_SPACE,
   FIRST_GROWABLE_PAGED_SPACE = OLD_SPACE,
   LAST_GROWABLE_PAGED_SPACE = MAP_SPACE
 };
@@ -607,6 +609,9 @@ enum VisitMode {
   VISIT_ALL_IN_SCAVENGE,
   VISIT_ALL_IN_SWEEP_NEWSPACE,
   VISIT_ONLY_STRONG,
+  // Like VISIT_ONLY_STRONG, but skips the roots that the mark-compact
+  // collector visits on parallel tasks.
+  VISIT_ONLY_STRONG_FOR_PARALLEL_MARKING,
   VISIT_FOR_SERIALIZATION,
 };
 
@@ -0,0 +1,94 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/heap/array-buffer-pool.h"
+
+#include "src/flags.h"
+#include "src/utils.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+base::LazyMutex pools_mutex = LAZY_MUTEX_INITIALIZER;
+// Pools keyed by the allocator that owns their memory.
+std::map<v8::ArrayBuffer::Allocator*, ArrayBufferPool*>* pools = nullptr;
+
+}  // namespace
+
+// static
+ArrayBufferPool* ArrayBufferPool::Acquire(
+    v8::ArrayBuffer::Allocator* allocator) {
+  DCHECK_NOT_NULL(allocator);
+  base::LockGuard<base::Mutex> guard(pools_mutex.Pointer());
+  if (pools == nullptr) {
+    pools = new std::map<v8::ArrayBuffer::Allocator*, ArrayBufferPool*>();
+  }
+  ArrayBufferPool*& pool = (*pools)[allocator];
+  if (pool == nullptr) {
+    pool = new ArrayBufferPool(
+        allocator, static_cast<size_t>(FLAG_array_buffer_pool_size) * MB);
+  }
+  pool->users_++;
+  return pool;
+}
+
+// static
+void ArrayBufferPool::Release(ArrayBufferPool* pool) {
+  base::LockGuard<base::Mutex> guard(pools_mutex.Pointer());
+  DCHECK_GT(pool->users_, 0);
+  if (--pool->users_ > 0) return;
+  pools->erase(pool->allocator_);
+  delete pool;
+  if (pools->empty()) {
+    delete pools;
+    pools = nullptr;
+  }
+}
+
+ArrayBufferPool::~ArrayBufferPool() {
+  for (auto& free_list : free_lists_) {
+    for (void* data : free_list.second) {
+      allocator_->Free(data, free_list.first);
+    }
+  }
+}
+
+void* ArrayBufferPool::Allocate(size_t length, bool initialize) {
+  void* data = nullptr;
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    auto it = free_lists_.find(length);
+    if (it == free_lists_.end()) return nullptr;
+    data = it->second.back();
+    it->second.pop_back();
+    if (it->second.empty()) free_lists_.erase(it);
+    pooled_bytes_ -= length;
+  }
+  // Clearing is deferred to here so that buffers that are about to be
+  // overwritten anyway never pay for it.
+  if (initialize) memset(data, 0, length);
+  return data;
+}
+
+bool ArrayBufferPool::Add(void* data, size_t length) {
+  if (length == 0 ||
+      length > static_cast<size_t>(FLAG_array_buffer_pool_max_length) * KB) {
+    return false;
+  }
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  if (pooled_bytes_ + length > capacity_) return false;
+  free_lists_[length].push_back(data);
+  pooled_bytes_ += length;
+  return true;
+}
+
+size_t ArrayBufferPool::pooled_bytes() {
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  return pooled_bytes_;
+}
+
+}  // namespace internal
+}  // namespace v8
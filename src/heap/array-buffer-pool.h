@@ -0,0 +1,70 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_HEAP_ARRAY_BUFFER_POOL_H_
+#define V8_HEAP_ARRAY_BUFFER_POOL_H_
+
+#include <map>
+#include <vector>
+
+#include "include/v8.h"
+#include "src/base/macros.h"
+#include "src/base/platform/mutex.h"
+#include "src/globals.h"
+
+namespace v8 {
+namespace internal {
+
+// Recycles the backing stores of dead array buffers for new array buffers,
+// bypassing the embedder's ArrayBuffer::Allocator. The backing store of a
+// regular array buffer is exactly as long as the buffer, so size classes are
+// exact lengths up to --array-buffer-pool-max-length.
+//
+// There is one pool per ArrayBuffer::Allocator, shared by all isolates that
+// use the allocator. Backing stores are pooled as they are and only
+// zero-filled when they are handed out for a buffer that needs initialized
+// memory. The pool holds at most --array-buffer-pool-size megabytes and
+// returns everything to the allocator when its last isolate goes away.
+class V8_EXPORT_PRIVATE ArrayBufferPool {
+ public:
+  // Returns the pool for |allocator| and registers a user of it.
+  static ArrayBufferPool* Acquire(v8::ArrayBuffer::Allocator* allocator);
+  // Unregisters a user. The last user frees all pooled backing stores.
+  static void Release(ArrayBufferPool* pool);
+
+  // Returns a pooled backing store of |length| bytes, or nullptr if there is
+  // none. If |initialize| is set the memory is zero-filled.
+  void* Allocate(size_t length, bool initialize);
+
+  // Offers the backing store of a dead array buffer to the pool. Returns
+  // false if the pool does not take it, in which case the caller has to
+  // free it. Can be called from background threads.
+  bool Add(void* data, size_t length);
+
+  size_t pooled_bytes();
+  size_t capacity() const { return capacity_; }
+
+ private:
+  ArrayBufferPool(v8::ArrayBuffer::Allocator* allocator, size_t capacity)
+      : allocator_(allocator),
+        capacity_(capacity),
+        pooled_bytes_(0),
+        users_(0) {}
+  ~ArrayBufferPool();
+
+  v8::ArrayBuffer::Allocator* const allocator_;
+  const size_t capacity_;
+  base::Mutex mutex_;
+  // Free backing stores by length.
+  std::map<size_t, std::vector<void*>> free_lists_;
+  size_t pooled_bytes_;
+  int users_;
+
+  DISALLOW_COPY_AND_ASSIGN(ArrayBufferPool);
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_HEAP_ARRAY_BUFFER_POOL_H_
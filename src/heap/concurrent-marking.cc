@@ -9,6 +9,7 @@
 
 #include "include/v8config.h"
 #include "src/base/template-utils.h"
+#include "src/heap/embedder-tracing.h"
 #include "src/heap/gc-tracer.h"
 #include "src/heap/heap-inl.h"
 #include "src/heap/heap.h"
@@ -73,14 +74,21 @@ class ConcurrentMarkingVisitor final
  public:
   using BaseClass = HeapVisitor<int, ConcurrentMarkingVisitor>;
 
+  // Wrappers are handed to the embedder in batches of this size.
+  static const size_t kWrapperBatchSize = 128;
+
   explicit ConcurrentMarkingVisitor(ConcurrentMarking::MarkingWorklist* shared,
                                     ConcurrentMarking::MarkingWorklist* bailout,
                                     LiveBytesMap* live_bytes,
-                                    WeakObjects* weak_objects, int task_id)
+                                    WeakObjects* weak_objects, Heap* heap,
+                                    LocalEmbedderHeapTracer* embedder_tracer,
+                                    int task_id)
       : shared_(shared, task_id),
         bailout_(bailout, task_id),
         weak_objects_(weak_objects),
         marking_state_(live_bytes),
+        heap_(heap),
+        embedder_tracer_(embedder_tracer),
         task_id_(task_id) {}
 
   template <typename T>
@@ -182,11 +190,36 @@ class ConcurrentMarkingVisitor final
   }
 
   int VisitJSApiObject(Map* map, JSObject* object) {
-    if (marking_state_.IsGrey(object)) {
-      // The main thread will do wrapper tracing in Blink.
-      bailout_.Push(object);
+    if (embedder_tracer_ == nullptr) {
+      if (marking_state_.IsGrey(object)) {
+        // The main thread will do wrapper tracing in Blink.
+        bailout_.Push(object);
+      }
+      return 0;
     }
-    return 0;
+    int size = VisitJSObjectSubclass(map, object);
+    // Only the task that turned the object black records its wrapper.
+    LocalEmbedderHeapTracer::WrapperInfo info;
+    if (size > 0 && heap_->ExtractWrapperInfo(map, object, &info)) {
+      wrappers_.push_back(info);
+      if (wrappers_.size() >= kWrapperBatchSize) TraceWrappers();
+    }
+    return size;
+  }
+
+  // Hands the recorded wrappers to the embedder and pushes the objects it
+  // reported back onto the marking worklist. Returns false if there were no
+  // wrappers to trace.
+  bool TraceWrappers() {
+    if (wrappers_.empty()) return false;
+    embedder_tracer_->TraceWrappersConcurrently(wrappers_);
+    wrappers_.clear();
+    embedder_tracer_->FlushConcurrentlyDiscoveredObjects(&discovered_objects_);
+    for (HeapObject* object : discovered_objects_) {
+      shared_.Push(object);
+    }
+    discovered_objects_.clear();
+    return true;
   }
 
   int VisitJSFunction(Map* map, JSFunction* object) {
@@ -352,9 +385,54 @@ class ConcurrentMarkingVisitor final
   }
 
   int VisitJSWeakCollection(Map* map, JSWeakCollection* object) {
-    // TODO(ulan): implement iteration of strong fields.
-    bailout_.Push(object);
-    return 0;
+    if (!FLAG_concurrent_weak_collection_marking) {
+      bailout_.Push(object);
+      return 0;
+    }
+    int size = JSWeakCollection::BodyDescriptorWeak::SizeOf(map, object);
+    int used_size = map->UsedInstanceSize();
+    DCHECK_LE(used_size, size);
+    DCHECK_GE(used_size, JSWeakCollection::kSize);
+    const SlotSnapshot& snapshot = MakeSlotSnapshotWeak(map, object, used_size);
+    Object** table_slot =
+        HeapObject::RawField(object, JSWeakCollection::kTableOffset);
+    Object* table = base::AsAtomicPointer::Relaxed_Load(table_slot);
+    if (!ShouldVisit(object)) return 0;
+    VisitPointersInSnapshot(object, snapshot);
+    // Partially initialized weak collection is enqueued, but table is ignored.
+    if (table->IsHashTable()) {
+      ObjectHashTable* hash_table = reinterpret_cast<ObjectHashTable*>(table);
+      MarkCompactCollector::RecordSlot(object, table_slot, hash_table);
+      // Mark the backing hash table without pushing it on the marking stack.
+      if (marking_state_.WhiteToBlack(hash_table)) {
+        MarkValuesOfMarkedKeys(hash_table);
+      }
+    }
+    // The table is scanned for ephemerons on the main thread in the atomic
+    // pause.
+    weak_objects_->weak_collections.Push(task_id_, object);
+    return size;
+  }
+
+  // Marks the values of entries whose keys are already marked so that their
+  // transitive closure is marked concurrently instead of in the atomic pause.
+  // The mutator may be rehashing the table, so a value can be marked for a
+  // dead key. This only retains the value until the next GC. The slots are
+  // recorded when the table is scanned in the atomic pause.
+  void MarkValuesOfMarkedKeys(ObjectHashTable* table) {
+    int capacity = Smi::ToInt(base::AsAtomicPointer::Relaxed_Load(
+        table->RawFieldOfElementAt(ObjectHashTable::kCapacityIndex)));
+    for (int i = 0; i < capacity; i++) {
+      Object* key = base::AsAtomicPointer::Relaxed_Load(
+          table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i)));
+      if (!key->IsHeapObject() ||
+          !marking_state_.IsBlackOrGrey(HeapObject::cast(key))) {
+        continue;
+      }
+      Object* value = base::AsAtomicPointer::Relaxed_Load(
+          table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i)));
+      if (value->IsHeapObject()) MarkObject(HeapObject::cast(value));
+    }
   }
 
   void MarkObject(HeapObject* object) {
@@ -447,6 +525,10 @@ class ConcurrentMarkingVisitor final
   ConcurrentMarking::MarkingWorklist::View bailout_;
   WeakObjects* weak_objects_;
   ConcurrentMarkingState marking_state_;
+  Heap* heap_;
+  LocalEmbedderHeapTracer* embedder_tracer_;
+  LocalEmbedderHeapTracer::WrapperCache wrappers_;
+  std::vector<HeapObject*> discovered_objects_;
   int task_id_;
   SlotSnapshot slot_snapshot_;
 };
@@ -527,8 +609,13 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
                       GCTracer::BackgroundScope::MC_BACKGROUND_MARKING);
   size_t kBytesUntilInterruptCheck = 64 * KB;
   int kObjectsUntilInterrupCheck = 1000;
+  LocalEmbedderHeapTracer* embedder_tracer =
+      heap_->local_embedder_heap_tracer()->IsConcurrentTracingEnabled()
+          ? heap_->local_embedder_heap_tracer()
+          : nullptr;
   ConcurrentMarkingVisitor visitor(shared_, bailout_, &task_state->live_bytes,
-                                   weak_objects_, task_id);
+                                   weak_objects_, heap_, embedder_tracer,
+                                   task_id);
   double time_ms;
   size_t marked_bytes = 0;
   if (FLAG_trace_concurrent_marking) {
@@ -546,6 +633,8 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
              objects_processed < kObjectsUntilInterrupCheck) {
         HeapObject* object;
         if (!shared_->Pop(task_id, &object)) {
+          // Tracing the pending wrappers may discover more objects.
+          if (embedder_tracer != nullptr && visitor.TraceWrappers()) continue;
           done = true;
           break;
         }
@@ -569,6 +658,10 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
         break;
       }
     }
+    if (embedder_tracer != nullptr) {
+      // Wrappers recorded by a preempted task must not be lost.
+      visitor.TraceWrappers();
+    }
     shared_->FlushToGlobal(task_id);
     bailout_->FlushToGlobal(task_id);
     on_hold_->FlushToGlobal(task_id);
@@ -576,6 +669,7 @@ void ConcurrentMarking::Run(int task_id, TaskState* task_state) {
     weak_objects_->weak_cells.FlushToGlobal(task_id);
     weak_objects_->transition_arrays.FlushToGlobal(task_id);
     weak_objects_->weak_references.FlushToGlobal(task_id);
+    weak_objects_->weak_collections.FlushToGlobal(task_id);
     base::AsAtomicWord::Relaxed_Store<size_t>(&task_state->marked_bytes, 0);
     total_marked_bytes_.Increment(marked_bytes);
     {
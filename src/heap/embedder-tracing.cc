@@ -15,12 +15,17 @@ void LocalEmbedderHeapTracer::TracePrologue() {
   CHECK(cached_wrappers_to_trace_.empty());
   num_v8_marking_worklist_was_empty_ = 0;
   remote_tracer_->TracePrologue();
+  concurrent_tracing_enabled_ = FLAG_concurrent_marking &&
+                                FLAG_concurrent_embedder_tracing &&
+                                remote_tracer_->SupportsConcurrentTracing();
 }
 
 void LocalEmbedderHeapTracer::TraceEpilogue() {
   if (!InUse()) return;
 
   CHECK(cached_wrappers_to_trace_.empty());
+  CHECK(discovered_objects_.empty());
+  concurrent_tracing_enabled_ = false;
   remote_tracer_->TraceEpilogue();
 }
 
@@ -28,6 +33,11 @@ void LocalEmbedderHeapTracer::AbortTracing() {
   if (!InUse()) return;
 
   cached_wrappers_to_trace_.clear();
+  {
+    base::LockGuard<base::Mutex> guard(&discovered_objects_mutex_);
+    discovered_objects_.clear();
+  }
+  concurrent_tracing_enabled_ = false;
   remote_tracer_->AbortTracing();
 }
 
@@ -63,6 +73,28 @@ void LocalEmbedderHeapTracer::RegisterWrappersWithRemoteTracer() {
   cached_wrappers_to_trace_.clear();
 }
 
+void LocalEmbedderHeapTracer::TraceWrappersConcurrently(
+    const WrapperCache& wrappers) {
+  DCHECK(IsConcurrentTracingEnabled());
+  if (wrappers.empty()) return;
+
+  remote_tracer_->TraceV8ReferencesConcurrently(wrappers);
+}
+
+void LocalEmbedderHeapTracer::AddConcurrentlyDiscoveredObject(
+    HeapObject* object) {
+  base::LockGuard<base::Mutex> guard(&discovered_objects_mutex_);
+  discovered_objects_.push_back(object);
+}
+
+void LocalEmbedderHeapTracer::FlushConcurrentlyDiscoveredObjects(
+    std::vector<HeapObject*>* objects) {
+  base::LockGuard<base::Mutex> guard(&discovered_objects_mutex_);
+  objects->insert(objects->end(), discovered_objects_.begin(),
+                  discovered_objects_.end());
+  discovered_objects_.clear();
+}
+
 bool LocalEmbedderHeapTracer::RequiresImmediateWrapperProcessing() {
   const size_t kTooManyWrappers = 16000;
   return cached_wrappers_to_trace_.size() > kTooManyWrappers;
@@ -5,7 +5,10 @@
 #ifndef V8_HEAP_EMBEDDER_TRACING_H_
 #define V8_HEAP_EMBEDDER_TRACING_H_
 
+#include <vector>
+
 #include "include/v8.h"
+#include "src/base/platform/mutex.h"
 #include "src/flags.h"
 #include "src/globals.h"
 
@@ -13,13 +16,17 @@ namespace v8 {
 namespace internal {
 
 class Heap;
+class HeapObject;
 
 class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
  public:
   typedef std::pair<void*, void*> WrapperInfo;
+  typedef std::vector<WrapperInfo> WrapperCache;
 
   LocalEmbedderHeapTracer()
-      : remote_tracer_(nullptr), num_v8_marking_worklist_was_empty_(0) {}
+      : remote_tracer_(nullptr),
+        num_v8_marking_worklist_was_empty_(0),
+        concurrent_tracing_enabled_(false) {}
 
   void SetRemoteTracer(EmbedderHeapTracer* tracer) { remote_tracer_ = tracer; }
   bool InUse() { return remote_tracer_ != nullptr; }
@@ -55,12 +62,34 @@ class V8_EXPORT_PRIVATE LocalEmbedderHeapTracer final {
            num_v8_marking_worklist_was_empty_ > kMaxIncrementalFixpointRounds;
   }
 
- private:
-  typedef std::vector<WrapperInfo> WrapperCache;
+  // Concurrent tracing is decided once per GC cycle in TracePrologue. When
+  // enabled, concurrent marking tasks trace the wrappers they find themselves
+  // instead of bailing them out to the main thread.
+  bool IsConcurrentTracingEnabled() const {
+    return concurrent_tracing_enabled_;
+  }
 
+  // Hands |wrappers| to the embedder on the calling concurrent marking thread.
+  // Objects reported back by the embedder during the call are collected and
+  // can be retrieved with FlushConcurrentlyDiscoveredObjects.
+  void TraceWrappersConcurrently(const WrapperCache& wrappers);
+
+  // Thread-safe. Records an object that was reported by the embedder during
+  // concurrent tracing and already marked grey by the caller.
+  void AddConcurrentlyDiscoveredObject(HeapObject* object);
+
+  // Thread-safe. Moves all objects discovered through concurrent tracing so
+  // far to |objects|.
+  void FlushConcurrentlyDiscoveredObjects(std::vector<HeapObject*>* objects);
+
+ private:
   EmbedderHeapTracer* remote_tracer_;
   WrapperCache cached_wrappers_to_trace_;
   size_t num_v8_marking_worklist_was_empty_;
+  bool concurrent_tracing_enabled_;
+
+  base::Mutex discovered_objects_mutex_;
+  std::vector<HeapObject*> discovered_objects_;
 };
 
 }  // namespace internal
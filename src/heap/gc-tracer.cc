@@ -120,6 +120,10 @@ GCTracer::Event::Event(Type type, GarbageCollectionReason gc_reason,
   for (int i = 0; i < Scope::NUMBER_OF_SCOPES; i++) {
     scopes[i] = 0;
   }
+  for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
+    start_space_object_size[i] = 0;
+    end_space_object_size[i] = 0;
+  }
 }
 
 const char* GCTracer::Event::TypeName(bool short_name) const {
@@ -185,6 +189,7 @@ void GCTracer::ResetForTesting() {
   recorded_minor_gcs_total_.Reset();
   recorded_minor_gcs_survived_.Reset();
   recorded_compactions_.Reset();
+  recorded_evacuation_pauses_.Reset();
   recorded_mark_compacts_.Reset();
   recorded_incremental_mark_compacts_.Reset();
   recorded_new_generation_allocations_.Reset();
@@ -245,6 +250,9 @@ void GCTracer::Start(GarbageCollector collector,
   current_.start_memory_size = heap_->memory_allocator()->Size();
   current_.start_holes_size = CountTotalHolesSize(heap_);
   current_.new_space_object_size = heap_->new_space()->Size();
+  if (!statistics_callbacks_.empty()) {
+    SampleSpaceObjectSizes(current_.start_space_object_size);
+  }
 
   current_.incremental_marking_bytes = 0;
   current_.incremental_marking_duration = 0;
@@ -302,6 +310,9 @@ void GCTracer::Stop(GarbageCollector collector) {
   current_.end_memory_size = heap_->memory_allocator()->Size();
   current_.end_holes_size = CountTotalHolesSize(heap_);
   current_.survived_new_space_object_size = heap_->SurvivedNewSpaceObjectSize();
+  if (!statistics_callbacks_.empty()) {
+    SampleSpaceObjectSizes(current_.end_space_object_size);
+  }
 
   AddAllocation(current_.end_time);
 
@@ -376,6 +387,89 @@ void GCTracer::Stop(GarbageCollector collector) {
 }
 
 
+void GCTracer::SampleSpaceObjectSizes(size_t* sizes) {
+  for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
+    sizes[i] = heap_->space(i)->SizeOfObjects();
+  }
+}
+
+void GCTracer::AddStatisticsCallback(v8::GCStatisticsCallback callback,
+                                     void* data) {
+  statistics_callbacks_.push_back(std::make_pair(callback, data));
+}
+
+void GCTracer::RemoveStatisticsCallback(v8::GCStatisticsCallback callback,
+                                        void* data) {
+  for (size_t i = 0; i < statistics_callbacks_.size(); i++) {
+    if (statistics_callbacks_[i].first == callback &&
+        statistics_callbacks_[i].second == data) {
+      statistics_callbacks_.erase(statistics_callbacks_.begin() + i);
+      return;
+    }
+  }
+  UNREACHABLE();
+}
+
+void GCTracer::InvokeStatisticsCallbacks() {
+  if (statistics_callbacks_.empty() || start_counter_ != 0) return;
+  STATIC_ASSERT(LAST_SPACE < v8::GCStatistics::kMaxNumberOfSpaces);
+
+  v8::GCStatistics statistics;
+  statistics.is_reducing_memory_ = current_.reduce_memory;
+  statistics.start_time_ = current_.start_time;
+  statistics.pause_duration_ = current_.end_time - current_.start_time;
+  statistics.heap_size_before_ = current_.start_object_size;
+  statistics.heap_size_after_ = current_.end_object_size;
+  double* phases = statistics.phase_duration_;
+  switch (current_.type) {
+    case Event::SCAVENGER:
+      statistics.gc_type_ = kGCTypeScavenge;
+      phases[v8::GCStatistics::kEvacuate] =
+          current_.scopes[Scope::SCAVENGER_SCAVENGE];
+      break;
+    case Event::MINOR_MARK_COMPACTOR:
+      statistics.gc_type_ = kGCTypeScavenge;
+      phases[v8::GCStatistics::kMark] = current_.scopes[Scope::MINOR_MC_MARK];
+      phases[v8::GCStatistics::kSweep] =
+          current_.scopes[Scope::MINOR_MC_SWEEPING];
+      phases[v8::GCStatistics::kEvacuate] =
+          current_.scopes[Scope::MINOR_MC_EVACUATE];
+      phases[v8::GCStatistics::kClear] = current_.scopes[Scope::MINOR_MC_CLEAR];
+      break;
+    case Event::MARK_COMPACTOR:
+    case Event::INCREMENTAL_MARK_COMPACTOR:
+      statistics.gc_type_ = kGCTypeMarkSweepCompact;
+      statistics.incremental_marking_duration_ =
+          current_.incremental_marking_duration;
+      phases[v8::GCStatistics::kMark] = current_.scopes[Scope::MC_MARK];
+      phases[v8::GCStatistics::kSweep] = current_.scopes[Scope::MC_SWEEP];
+      phases[v8::GCStatistics::kEvacuate] = current_.scopes[Scope::MC_EVACUATE];
+      phases[v8::GCStatistics::kClear] = current_.scopes[Scope::MC_CLEAR];
+      break;
+    case Event::START:
+      UNREACHABLE();
+  }
+  phases[v8::GCStatistics::kEmbedderCallbacks] = TotalExternalTime();
+  if (statistics.gc_type_ == kGCTypeScavenge) {
+    statistics.promoted_bytes_ = heap_->promoted_objects_size();
+    statistics.survived_young_bytes_ = heap_->semi_space_copied_object_size();
+  }
+  statistics.number_of_spaces_ = LAST_SPACE + 1;
+  for (int i = FIRST_SPACE; i <= LAST_SPACE; i++) {
+    statistics.space_name_[i] = heap_->GetSpaceName(i);
+    statistics.space_size_before_[i] = current_.start_space_object_size[i];
+    statistics.space_size_after_[i] = current_.end_space_object_size[i];
+  }
+
+  // Callbacks may remove themselves, so iterate over a copy.
+  std::vector<std::pair<v8::GCStatisticsCallback, void*>> callbacks(
+      statistics_callbacks_);
+  v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap_->isolate());
+  for (const auto& callback : callbacks) {
+    callback.first(isolate, statistics, callback.second);
+  }
+}
+
 void GCTracer::SampleAllocation(double current_ms,
                                 size_t new_space_counter_bytes,
                                 size_t old_generation_counter_bytes) {
@@ -430,6 +524,12 @@ void GCTracer::AddCompactionEvent(double duration,
 }
 
 
+void GCTracer::AddEvacuationPauseEvent(double duration,
+                                       size_t live_bytes_evacuated) {
+  recorded_evacuation_pauses_.Push(
+      MakeBytesAndDuration(live_bytes_evacuated, duration));
+}
+
 void GCTracer::AddSurvivalRatio(double promotion_ratio) {
   recorded_survival_ratios_.Push(promotion_ratio);
 }
@@ -617,10 +717,15 @@ void GCTracer::PrintNVP() const {
           "clear.string_table=%.2f "
           "clear.weak_lists=%.2f "
           "evacuate=%.2f "
+          "evacuate.prologue=%.2f "
           "evacuate.copy=%.2f "
           "evacuate.update_pointers=%.2f "
           "evacuate.update_pointers.to_new_roots=%.2f "
           "evacuate.update_pointers.slots=%.2f "
+          "evacuate.update_pointers.weak=%.2f "
+          "evacuate.rebalance=%.2f "
+          "evacuate.clean_up=%.2f "
+          "evacuate.epilogue=%.2f "
           "background.mark=%.2f "
           "background.evacuate.copy=%.2f "
           "background.evacuate.update_pointers=%.2f "
@@ -641,11 +746,16 @@ void GCTracer::PrintNVP() const {
           current_.scopes[Scope::MINOR_MC_CLEAR_STRING_TABLE],
           current_.scopes[Scope::MINOR_MC_CLEAR_WEAK_LISTS],
           current_.scopes[Scope::MINOR_MC_EVACUATE],
+          current_.scopes[Scope::MINOR_MC_EVACUATE_PROLOGUE],
           current_.scopes[Scope::MINOR_MC_EVACUATE_COPY],
           current_.scopes[Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS],
           current_
               .scopes[Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_TO_NEW_ROOTS],
           current_.scopes[Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_SLOTS],
+          current_.scopes[Scope::MINOR_MC_EVACUATE_UPDATE_POINTERS_WEAK],
+          current_.scopes[Scope::MINOR_MC_EVACUATE_REBALANCE],
+          current_.scopes[Scope::MINOR_MC_EVACUATE_CLEAN_UP],
+          current_.scopes[Scope::MINOR_MC_EVACUATE_EPILOGUE],
           current_.scopes[Scope::MINOR_MC_BACKGROUND_MARKING],
           current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_COPY],
           current_.scopes[Scope::MINOR_MC_BACKGROUND_EVACUATE_UPDATE_POINTERS],
@@ -947,6 +1057,10 @@ double GCTracer::CompactionSpeedInBytesPerMillisecond() const {
   return AverageSpeed(recorded_compactions_);
 }
 
+double GCTracer::EvacuationPauseSpeedInBytesPerMillisecond() const {
+  return AverageSpeed(recorded_evacuation_pauses_);
+}
+
 double GCTracer::MarkCompactSpeedInBytesPerMillisecond() const {
   return AverageSpeed(recorded_mark_compacts_);
 }
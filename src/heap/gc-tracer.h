@@ -5,6 +5,9 @@
 #ifndef V8_HEAP_GC_TRACER_H_
 #define V8_HEAP_GC_TRACER_H_
 
+#include <utility>
+#include <vector>
+
 #include "src/base/compiler-specific.h"
 #include "src/base/platform/platform.h"
 #include "src/base/ring-buffer.h"
@@ -183,6 +186,11 @@ class V8_EXPORT_PRIVATE GCTracer {
     // Size of survived new space objects in destructor.
     size_t survived_new_space_object_size;
 
+    // Per-space size of objects in constructor and destructor. Only sampled
+    // if statistics callbacks are registered.
+    size_t start_space_object_size[LAST_SPACE + 1];
+    size_t end_space_object_size[LAST_SPACE + 1];
+
     // Bytes marked incrementally for INCREMENTAL_MARK_COMPACTOR
     size_t incremental_marking_bytes;
 
@@ -224,6 +232,11 @@ class V8_EXPORT_PRIVATE GCTracer {
 
   void AddCompactionEvent(double duration, size_t live_bytes_compacted);
 
+  // Log the duration of a full GC evacuation, from copying objects until
+  // pointers have been updated, for the live bytes of its old generation
+  // evacuation candidates.
+  void AddEvacuationPauseEvent(double duration, size_t live_bytes_evacuated);
+
   void AddSurvivalRatio(double survival_ratio);
 
   // Log an incremental marking step.
@@ -242,6 +255,10 @@ class V8_EXPORT_PRIVATE GCTracer {
   // Returns 0 if not enough events have been recorded.
   double CompactionSpeedInBytesPerMillisecond() const;
 
+  // Compute the average speed of whole evacuation pauses in bytes/millisecond.
+  // Returns 0 if no events have been recorded.
+  double EvacuationPauseSpeedInBytesPerMillisecond() const;
+
   // Compute the average mark-sweep speed in bytes/millisecond.
   // Returns 0 if no events have been recorded.
   double MarkCompactSpeedInBytesPerMillisecond() const;
@@ -319,6 +336,15 @@ class V8_EXPORT_PRIVATE GCTracer {
   void AddBackgroundScopeSample(BackgroundScope::ScopeId scope, double duration,
                                 RuntimeCallCounter* runtime_call_counter);
 
+  // Embedder callbacks receiving structured statistics after every GC.
+  void AddStatisticsCallback(v8::GCStatisticsCallback callback, void* data);
+  void RemoveStatisticsCallback(v8::GCStatisticsCallback callback,
+                                void* data);
+
+  // Reports the last finished event to the statistics callbacks. Must be
+  // called after Stop() outside of any nested GC.
+  void InvokeStatisticsCallbacks();
+
  private:
   FRIEND_TEST(GCTracer, AverageSpeed);
   FRIEND_TEST(GCTracerTest, AllocationThroughput);
@@ -380,6 +406,8 @@ class V8_EXPORT_PRIVATE GCTracer {
   void FetchBackgroundMarkCompactCounters();
   void FetchBackgroundGeneralCounters();
 
+  void SampleSpaceObjectSizes(size_t* sizes);
+
   // Pointer to the heap that owns this tracer.
   Heap* heap_;
 
@@ -432,6 +460,7 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::RingBuffer<BytesAndDuration> recorded_minor_gcs_total_;
   base::RingBuffer<BytesAndDuration> recorded_minor_gcs_survived_;
   base::RingBuffer<BytesAndDuration> recorded_compactions_;
+  base::RingBuffer<BytesAndDuration> recorded_evacuation_pauses_;
   base::RingBuffer<BytesAndDuration> recorded_incremental_mark_compacts_;
   base::RingBuffer<BytesAndDuration> recorded_mark_compacts_;
   base::RingBuffer<BytesAndDuration> recorded_new_generation_allocations_;
@@ -442,6 +471,9 @@ class V8_EXPORT_PRIVATE GCTracer {
   base::Mutex background_counter_mutex_;
   BackgroundCounter background_counter_[BackgroundScope::NUMBER_OF_SCOPES];
 
+  std::vector<std::pair<v8::GCStatisticsCallback, void*>>
+      statistics_callbacks_;
+
   DISALLOW_COPY_AND_ASSIGN(GCTracer);
 };
 
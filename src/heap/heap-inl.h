@@ -99,6 +99,7 @@ ROOT_LIST(ROOT_ACCESSOR)
 PagedSpace* Heap::paged_space(int idx) {
   DCHECK_NE(idx, LO_SPACE);
   DCHECK_NE(idx, NEW_SPACE);
+  DCHECK_NE(idx, NEW_LO_SPACE);
   return static_cast<PagedSpace*>(space_[idx]);
 }
 
@@ -150,6 +151,15 @@ AllocationResult Heap::AllocateRaw(int size_in_bytes, AllocationSpace space,
   AllocationResult allocation;
   if (NEW_SPACE == space) {
     if (large_object) {
+      // The minor mark-compactor does not handle the young generation large
+      // object space, so those isolates keep tenuring large objects.
+      if (FLAG_young_generation_large_objects && !use_minor_mc_) {
+        allocation = new_lo_space_->AllocateRaw(size_in_bytes);
+        if (allocation.To(&object)) {
+          OnAllocationEvent(object, size_in_bytes);
+        }
+        return allocation;
+      }
       space = LO_SPACE;
     } else {
       allocation = new_space_->AllocateRaw(size_in_bytes, alignment);
@@ -366,6 +376,10 @@ bool Heap::InToSpace(HeapObject* heap_object) {
 
 bool Heap::InOldSpace(Object* object) { return old_space_->Contains(object); }
 
+bool Heap::IsLargeObject(HeapObject* object) {
+  return lo_space_->Contains(object) || new_lo_space_->Contains(object);
+}
+
 bool Heap::InNewSpaceSlow(Address address) {
   return new_space_->ContainsSlow(address);
 }
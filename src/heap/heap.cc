@@ -23,6 +23,7 @@
 #include "src/feedback-vector.h"
 #include "src/global-handles.h"
 #include "src/heap/array-buffer-collector.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/heap/array-buffer-tracker-inl.h"
 #include "src/heap/barrier.h"
 #include "src/heap/code-stats.h"
@@ -168,6 +169,7 @@ Heap::Heap()
       code_space_(nullptr),
       map_space_(nullptr),
       lo_space_(nullptr),
+      new_lo_space_(nullptr),
       read_only_space_(nullptr),
       write_protect_code_memory_(false),
       code_space_memory_modification_scope_depth_(0),
@@ -201,6 +203,7 @@ Heap::Heap()
       mark_compact_collector_(nullptr),
       minor_mark_compact_collector_(nullptr),
       array_buffer_collector_(nullptr),
+      array_buffer_pool_(nullptr),
       memory_allocator_(nullptr),
       store_buffer_(nullptr),
       incremental_marking_(nullptr),
@@ -209,6 +212,9 @@ Heap::Heap()
       memory_reducer_(nullptr),
       live_object_stats_(nullptr),
       dead_object_stats_(nullptr),
+      sampled_live_object_stats_(nullptr),
+      sampled_dead_object_stats_(nullptr),
+      object_stats_sampling_rate_(0),
       scavenge_job_(nullptr),
       parallel_scavenge_semaphore_(0),
       idle_scavenge_observer_(nullptr),
@@ -229,6 +235,7 @@ Heap::Heap()
       heap_iterator_depth_(0),
       local_embedder_heap_tracer_(nullptr),
       fast_promotion_mode_(false),
+      use_minor_mc_(false),
       force_oom_(false),
       delay_sweeper_tasks_for_testing_(false),
       pending_layout_change_object_(nullptr),
@@ -241,6 +248,10 @@ Heap::Heap()
   // Ensure old_generation_size_ is a multiple of kPageSize.
   DCHECK_EQ(0, max_old_generation_size_ & (Page::kPageSize - 1));
 
+#ifdef ENABLE_MINOR_MC
+  use_minor_mc_ = FLAG_minor_mc;
+#endif  // ENABLE_MINOR_MC
+
   memset(roots_, 0, sizeof(roots_[0]) * kRootListLength);
   set_native_contexts_list(nullptr);
   set_allocation_sites_list(Smi::kZero);
@@ -288,7 +299,8 @@ size_t Heap::CommittedOldGenerationMemory() {
 size_t Heap::CommittedMemory() {
   if (!HasBeenSetUp()) return 0;
 
-  return new_space_->CommittedMemory() + CommittedOldGenerationMemory();
+  return new_space_->CommittedMemory() + new_lo_space_->Size() +
+         CommittedOldGenerationMemory();
 }
 
 
@@ -342,14 +354,14 @@ bool Heap::CanExpandOldGeneration(size_t size) {
 bool Heap::HasBeenSetUp() {
   return old_space_ != nullptr && code_space_ != nullptr &&
          map_space_ != nullptr && lo_space_ != nullptr &&
-         read_only_space_ != nullptr;
+         new_lo_space_ != nullptr && read_only_space_ != nullptr;
 }
 
 
 GarbageCollector Heap::SelectGarbageCollector(AllocationSpace space,
                                               const char** reason) {
   // Is global GC requested?
-  if (space != NEW_SPACE) {
+  if (space != NEW_SPACE && space != NEW_LO_SPACE) {
     isolate_->counters()->gc_compactor_caused_by_request()->Increment();
     *reason = "GC in old space requested";
     return MARK_COMPACTOR;
@@ -435,6 +447,14 @@ void Heap::PrintShortHeapStatistics() {
                          ", committed: %6" PRIuS " KB\n",
                lo_space_->SizeOfObjects() / KB, lo_space_->Available() / KB,
                lo_space_->CommittedMemory() / KB);
+  PrintIsolate(isolate_, "New large object space, used: %6" PRIuS
+                         " KB"
+                         ", available: %6" PRIuS
+                         " KB"
+                         ", committed: %6" PRIuS " KB\n",
+               new_lo_space_->SizeOfObjects() / KB,
+               new_lo_space_->Available() / KB,
+               new_lo_space_->CommittedMemory() / KB);
   PrintIsolate(isolate_, "All spaces,         used: %6" PRIuS
                          " KB"
                          ", available: %6" PRIuS
@@ -658,6 +678,8 @@ const char* Heap::GetSpaceName(int idx) {
       return "code_space";
     case LO_SPACE:
       return "large_object_space";
+    case NEW_LO_SPACE:
+      return "new_large_object_space";
     case RO_SPACE:
       return "read_only_space";
     default:
@@ -741,6 +763,7 @@ class Heap::SkipStoreBufferScope {
   ~SkipStoreBufferScope() {
     DCHECK(store_buffer_->Empty());
     store_buffer_->SetMode(StoreBuffer::NOT_IN_GC);
+    store_buffer_->StartRememberedSetCompaction();
   }
 
  private:
@@ -1424,6 +1447,8 @@ bool Heap::CollectGarbage(AllocationSpace space,
     tracer()->Stop(collector);
   }
 
+  tracer()->InvokeStatisticsCallbacks();
+
   if (collector == MARK_COMPACTOR &&
       (gc_callback_flags & (kGCCallbackFlagForced |
                             kGCCallbackFlagCollectAllAvailableGarbage)) != 0) {
@@ -1736,7 +1761,9 @@ bool Heap::PerformGarbageCollection(
         MinorMarkCompact();
         break;
       case SCAVENGER:
-        if ((fast_promotion_mode_ &&
+        // Fast promotion only moves semi space pages. Young generation large
+        // objects require a regular scavenge.
+        if ((fast_promotion_mode_ && new_lo_space()->IsEmpty() &&
              CanExpandOldGeneration(new_space()->Size()))) {
           tracer()->NotifyYoungGenerationHandling(
               YoungGenerationHandling::kFastPromotionDuringScavenge);
@@ -1874,7 +1901,7 @@ void Heap::MarkCompact() {
 
 void Heap::MinorMarkCompact() {
 #ifdef ENABLE_MINOR_MC
-  DCHECK(FLAG_minor_mc);
+  DCHECK(use_minor_mc_);
 
   PauseAllocationObserversScope pause_observers(this);
   SetGCState(MINOR_MARK_COMPACT);
@@ -2081,6 +2108,25 @@ int Heap::NumberOfScavengeTasks() {
   return tasks;
 }
 
+void Heap::FreeEmptyOldToNewBuckets() {
+  std::vector<MemoryChunk*> swept_chunks;
+  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
+      this, [&swept_chunks](MemoryChunk* chunk) {
+        if (!chunk->SweepingDone()) {
+          // The sweeper frees the pre-freed buckets.
+          RememberedSet<OLD_TO_NEW>::PreFreeEmptyBuckets(chunk);
+        } else if (FLAG_concurrent_remembered_set_compaction) {
+          swept_chunks.push_back(chunk);
+        } else {
+          RememberedSet<OLD_TO_NEW>::FreeEmptyBuckets(chunk);
+        }
+      });
+  if (!swept_chunks.empty()) {
+    store_buffer()->AddChunksForRememberedSetCompaction(
+        std::move(swept_chunks));
+  }
+}
+
 void Heap::Scavenge() {
   TRACE_GC(tracer(), GCTracer::Scope::SCAVENGER_SCAVENGE);
   base::LockGuard<base::Mutex> guard(relocation_mutex());
@@ -2109,6 +2155,7 @@ void Heap::Scavenge() {
   // live objects.
   new_space_->Flip();
   new_space_->ResetLinearAllocationArea();
+  new_lo_space_->Flip();
 
   ItemParallelJob job(isolate()->cancelable_task_manager(),
                       &parallel_scavenge_semaphore_);
@@ -2119,6 +2166,7 @@ void Heap::Scavenge() {
   OneshotBarrier barrier;
   Scavenger::CopiedList copied_list(num_scavenge_tasks);
   Scavenger::PromotionList promotion_list(num_scavenge_tasks);
+  Scavenger::SurvivingNewLargeObjects surviving_new_large_objects;
   for (int i = 0; i < num_scavenge_tasks; i++) {
     scavengers[i] =
         new Scavenger(this, is_logging, &copied_list, &promotion_list, i);
@@ -2191,10 +2239,16 @@ void Heap::Scavenge() {
 
     for (int i = 0; i < num_scavenge_tasks; i++) {
       scavengers[i]->Finalize();
+      const Scavenger::SurvivingNewLargeObjects& objects =
+          scavengers[i]->surviving_new_large_objects();
+      surviving_new_large_objects.insert(surviving_new_large_objects.end(),
+                                         objects.begin(), objects.end());
       delete scavengers[i];
     }
   }
 
+  PromoteSurvivingNewLargeObjects(surviving_new_large_objects);
+
   UpdateNewSpaceReferencesInExternalStringTable(
       &UpdateNewSpaceReferenceInExternalStringTableEntry);
 
@@ -2212,6 +2266,9 @@ void Heap::Scavenge() {
   ScavengeWeakObjectRetainer weak_object_retainer(this);
   ProcessYoungWeakReferences(&weak_object_retainer);
 
+  // All young generation large objects left are dead.
+  new_lo_space_->FreeAllObjects();
+
   // Set age mark.
   new_space_->set_age_mark(new_space_->top());
 
@@ -2221,13 +2278,7 @@ void Heap::Scavenge() {
   }
   array_buffer_collector()->FreeAllocationsOnBackgroundThread();
 
-  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(this, [](MemoryChunk* chunk) {
-    if (chunk->SweepingDone()) {
-      RememberedSet<OLD_TO_NEW>::FreeEmptyBuckets(chunk);
-    } else {
-      RememberedSet<OLD_TO_NEW>::PreFreeEmptyBuckets(chunk);
-    }
-  });
+  FreeEmptyOldToNewBuckets();
 
   // Update how much has survived scavenge.
   IncrementYoungSurvivorsCounter(SurvivedNewSpaceObjectSize());
@@ -2241,6 +2292,18 @@ void Heap::Scavenge() {
   SetGCState(NOT_IN_GC);
 }
 
+void Heap::PromoteSurvivingNewLargeObjects(
+    const std::vector<std::pair<HeapObject*, Map*>>& objects) {
+  for (const auto& object_and_map : objects) {
+    HeapObject* object = object_and_map.first;
+    // Restore the map that was replaced by a self-referencing forwarding
+    // address during scavenging.
+    object->set_map_word(MapWord::FromMap(object_and_map.second));
+    lo_space_->PromoteNewLargeObject(
+        static_cast<LargePage*>(MemoryChunk::FromHeapObject(object)));
+  }
+}
+
 void Heap::ComputeFastPromotionMode(double survival_rate) {
   const size_t survived_in_new_space =
       survived_last_scavenge_ * 100 / new_space_->Capacity();
@@ -2287,8 +2350,14 @@ String* Heap::UpdateNewSpaceReferenceInExternalStringTableEntry(Heap* heap,
   MapWord first_word = HeapObject::cast(*p)->map_word();
 
   if (!first_word.IsForwardingAddress()) {
-    // Unreachable external string can be finalized.
     String* string = String::cast(*p);
+    if (!heap->InFromSpace(string)) {
+      // Large strings of the young generation are promoted in place and do
+      // not leave a forwarding address behind.
+      if (string->IsThinString()) string = ThinString::cast(string)->actual();
+      return string->IsExternalString() ? string : nullptr;
+    }
+    // Unreachable external string can be finalized.
     if (!string->IsExternalString()) {
       // Original external string has been internalized.
       DCHECK(string->IsThinString());
@@ -2787,7 +2856,7 @@ bool Heap::CanMoveObjectStart(HeapObject* object) {
 
   Address address = object->address();
 
-  if (lo_space()->Contains(object)) return false;
+  if (IsLargeObject(object)) return false;
 
   // We can move the object start if the page was already swept.
   return Page::FromAddress(address)->SweepingDone();
@@ -2795,7 +2864,8 @@ bool Heap::CanMoveObjectStart(HeapObject* object) {
 
 bool Heap::IsImmovable(HeapObject* object) {
   MemoryChunk* chunk = MemoryChunk::FromAddress(object->address());
-  return chunk->NeverEvacuate() || chunk->owner()->identity() == LO_SPACE;
+  return chunk->NeverEvacuate() || chunk->owner()->identity() == LO_SPACE ||
+         chunk->owner()->identity() == NEW_LO_SPACE;
 }
 
 FixedArrayBase* Heap::LeftTrimFixedArray(FixedArrayBase* object,
@@ -2812,7 +2882,7 @@ FixedArrayBase* Heap::LeftTrimFixedArray(FixedArrayBase* object,
   // For now this trick is only applied to objects in new and paged space.
   // In large object space the object's start must coincide with chunk
   // and thus the trick is just not applicable.
-  DCHECK(!lo_space()->Contains(object));
+  DCHECK(!IsLargeObject(object));
   DCHECK(object->map() != fixed_cow_array_map());
 
   STATIC_ASSERT(FixedArrayBase::kMapOffset == 0);
@@ -2908,7 +2978,7 @@ void Heap::CreateFillerForArray(T* object, int elements_to_trim,
   // We do not create a filler for objects in large object space.
   // TODO(hpayer): We should shrink the large object page if the size
   // of the object changed significantly.
-  if (!lo_space()->Contains(object)) {
+  if (!IsLargeObject(object)) {
     HeapObject* filler =
         CreateFillerObjectAt(new_end, bytes_to_trim, ClearRecordedSlots::kYes);
     DCHECK_NOT_NULL(filler);
@@ -3346,6 +3416,114 @@ bool Heap::IdleNotification(double deadline_in_seconds) {
 }
 
 
+bool Heap::PerformIdleGarbageCollection(
+    double deadline_in_seconds, bool quiescent,
+    v8::IdleGarbageCollectionStatistics* statistics) {
+  CHECK(HasBeenSetUp());
+  double deadline_in_ms =
+      deadline_in_seconds *
+      static_cast<double>(base::Time::kMillisecondsPerSecond);
+  HistogramTimerScope idle_notification_scope(
+      isolate_->counters()->gc_idle_notification());
+  TRACE_EVENT0("v8", "V8.GCIdleGarbageCollection");
+  double start_ms = MonotonicallyIncreasingTimeInMs();
+  int start_gc_count = gc_count_;
+  int start_ms_count = ms_count_;
+  v8::IdleGarbageCollectionStatistics unused_statistics;
+  if (statistics == nullptr) statistics = &unused_statistics;
+
+  tracer()->SampleAllocation(start_ms, NewSpaceAllocationCounter(),
+                             OldGenerationAllocationCounter());
+
+  // Finalizing sweeping is cheap once the sweeper tasks are done, but would
+  // otherwise happen on the next allocation slow path.
+  if (mark_compact_collector()->sweeping_in_progress() &&
+      !mark_compact_collector()->sweeper()->AreSweeperTasksRunning()) {
+    mark_compact_collector()->EnsureSweepingCompleted();
+    statistics->finalized_sweeping_ = true;
+  }
+
+  // Scavenge if the young generation is about to fill up. In a quiescent
+  // period any non-trivial young generation is worth emptying.
+  double scavenge_speed_in_bytes_per_ms =
+      tracer()->ScavengeSpeedInBytesPerMillisecond();
+  size_t new_space_size = new_space()->Size();
+  bool should_scavenge =
+      quiescent ? new_space_size >= ScavengeJob::kMinAllocationLimit
+                : ScavengeJob::ReachedIdleAllocationLimit(
+                      scavenge_speed_in_bytes_per_ms, new_space_size,
+                      new_space()->Capacity());
+  if (should_scavenge &&
+      ScavengeJob::EnoughIdleTimeForScavenge(
+          deadline_in_ms - MonotonicallyIncreasingTimeInMs(),
+          scavenge_speed_in_bytes_per_ms, new_space_size)) {
+    CollectGarbage(NEW_SPACE, GarbageCollectionReason::kIdleTask);
+  }
+
+  if (quiescent && incremental_marking()->IsStopped()) {
+    if (memory_reducer_ != nullptr &&
+        memory_reducer_->StartPendingGC(MonotonicallyIncreasingTimeInMs())) {
+      statistics->started_incremental_marking_ = true;
+    } else if (IncrementalMarkingLimitReached() ==
+               IncrementalMarkingLimit::kSoftLimit) {
+      StartIdleIncrementalMarking(GarbageCollectionReason::kIdleTask);
+      statistics->started_incremental_marking_ =
+          !incremental_marking()->IsStopped();
+    }
+  }
+
+  if (!incremental_marking()->IsStopped() &&
+      deadline_in_ms - MonotonicallyIncreasingTimeInMs() >=
+          IncrementalMarking::kStepSizeInMs) {
+    double marking_start_ms = MonotonicallyIncreasingTimeInMs();
+    double remaining_idle_time_in_ms =
+        incremental_marking()->AdvanceIncrementalMarking(
+            deadline_in_ms, IncrementalMarking::NO_GC_VIA_STACK_GUARD,
+            StepOrigin::kTask);
+    statistics->incremental_marking_duration_ =
+        MonotonicallyIncreasingTimeInMs() - marking_start_ms;
+    // Over-approximating the weak closure is needed for marking to complete.
+    // The final pause is only done once marking is complete and the pause is
+    // expected to fit into the remaining idle time.
+    if (remaining_idle_time_in_ms > 0.0) {
+      double final_speed_in_bytes_per_ms =
+          tracer()->FinalIncrementalMarkCompactSpeedInBytesPerMillisecond();
+      if (incremental_marking()->IsReadyToOverApproximateWeakClosure()) {
+        FinalizeIncrementalMarking(
+            GarbageCollectionReason::kFinalizeMarkingViaTask);
+      } else if (incremental_marking()->IsComplete() &&
+                 GCIdleTimeHandler::ShouldDoFinalIncrementalMarkCompact(
+                     deadline_in_ms - MonotonicallyIncreasingTimeInMs(),
+                     static_cast<size_t>(SizeOfObjects()),
+                     final_speed_in_bytes_per_ms)) {
+        CollectAllGarbage(current_gc_flags_,
+                          GarbageCollectionReason::kFinalizeMarkingViaTask,
+                          current_gc_callback_flags_);
+      }
+    }
+  }
+
+  statistics->full_gcs_ = ms_count_ - start_ms_count;
+  statistics->scavenges_ = gc_count_ - start_gc_count - statistics->full_gcs_;
+  double end_ms = MonotonicallyIncreasingTimeInMs();
+  statistics->used_time_ = end_ms - start_ms;
+  last_idle_notification_time_ = end_ms;
+
+  if (FLAG_trace_idle_notification) {
+    isolate_->PrintWithTimestamp(
+        "Idle garbage collection: requested idle time %.2f ms, used idle time "
+        "%.2f ms, %s, scavenges=%d, full GCs=%d, marking=%.2f ms%s\n",
+        deadline_in_ms - start_ms, statistics->used_time_,
+        quiescent ? "quiescent" : "busy", statistics->scavenges_,
+        statistics->full_gcs_, statistics->incremental_marking_duration_,
+        statistics->finalized_sweeping_ ? ", finalized sweeping" : "");
+  }
+
+  return incremental_marking()->IsStopped() &&
+         !mark_compact_collector()->sweeping_in_progress();
+}
+
+
 bool Heap::RecentIdleNotificationHappened() {
   return (last_idle_notification_time_ +
           GCIdleTimeHandler::kMaxScheduledIdleTime) >
@@ -3571,7 +3749,8 @@ bool Heap::Contains(HeapObject* value) {
   return HasBeenSetUp() &&
          (new_space_->ToSpaceContains(value) || old_space_->Contains(value) ||
           code_space_->Contains(value) || map_space_->Contains(value) ||
-          lo_space_->Contains(value) || read_only_space_->Contains(value));
+          lo_space_->Contains(value) || new_lo_space_->Contains(value) ||
+          read_only_space_->Contains(value));
 }
 
 bool Heap::ContainsSlow(Address addr) {
@@ -3582,6 +3761,7 @@ bool Heap::ContainsSlow(Address addr) {
          (new_space_->ToSpaceContainsSlow(addr) ||
           old_space_->ContainsSlow(addr) || code_space_->ContainsSlow(addr) ||
           map_space_->ContainsSlow(addr) || lo_space_->ContainsSlow(addr) ||
+          new_lo_space_->ContainsSlow(addr) ||
           read_only_space_->Contains(addr));
 }
 
@@ -3602,6 +3782,8 @@ bool Heap::InSpace(HeapObject* value, AllocationSpace space) {
       return map_space_->Contains(value);
     case LO_SPACE:
       return lo_space_->Contains(value);
+    case NEW_LO_SPACE:
+      return new_lo_space_->Contains(value);
     case RO_SPACE:
       return read_only_space_->Contains(value);
   }
@@ -3625,6 +3807,8 @@ bool Heap::InSpaceSlow(Address addr, AllocationSpace space) {
       return map_space_->ContainsSlow(addr);
     case LO_SPACE:
       return lo_space_->ContainsSlow(addr);
+    case NEW_LO_SPACE:
+      return new_lo_space_->ContainsSlow(addr);
     case RO_SPACE:
       return read_only_space_->ContainsSlow(addr);
   }
@@ -3639,6 +3823,7 @@ bool Heap::IsValidAllocationSpace(AllocationSpace space) {
     case CODE_SPACE:
     case MAP_SPACE:
     case LO_SPACE:
+    case NEW_LO_SPACE:
     case RO_SPACE:
       return true;
     default:
@@ -3703,6 +3888,7 @@ void Heap::Verify() {
   code_space_->Verify(&no_dirty_regions_visitor);
 
   lo_space_->Verify();
+  new_lo_space_->Verify();
 
   VerifyReadOnlyPointersVisitor read_only_visitor;
   read_only_space_->Verify(&read_only_visitor);
@@ -3945,6 +4131,9 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
   const bool isMinorGC = mode == VISIT_ALL_IN_SCAVENGE ||
                          mode == VISIT_ALL_IN_MINOR_MC_MARK ||
                          mode == VISIT_ALL_IN_MINOR_MC_UPDATE;
+  // The compilation cache, builtins, global handles, and eternal handles are
+  // visited by MarkCompactCollector::MarkRootsInParallel in this mode.
+  const bool isParallelMarking = mode == VISIT_ONLY_STRONG_FOR_PARALLEL_MARKING;
   v->VisitRootPointers(Root::kStrongRootList, nullptr, &roots_[0],
                        &roots_[kStrongRootListLength]);
   v->Synchronize(VisitorSynchronization::kStrongRootList);
@@ -3958,7 +4147,9 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
   isolate_->debug()->Iterate(v);
   v->Synchronize(VisitorSynchronization::kDebug);
 
-  isolate_->compilation_cache()->Iterate(v);
+  if (!isParallelMarking) {
+    isolate_->compilation_cache()->Iterate(v);
+  }
   v->Synchronize(VisitorSynchronization::kCompilationCache);
 
   // Iterate over local handles in handle scopes.
@@ -3971,7 +4162,7 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
   // Iterate over the builtin code objects and code stubs in the
   // heap. Note that it is not necessary to iterate over code objects
   // on scavenge collections.
-  if (!isMinorGC) {
+  if (!isMinorGC && !isParallelMarking) {
     isolate_->builtins()->IterateBuiltins(v);
     v->Synchronize(VisitorSynchronization::kBuiltins);
     isolate_->interpreter()->IterateDispatchTable(v);
@@ -3987,6 +4178,8 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
     case VISIT_ONLY_STRONG:
       isolate_->global_handles()->IterateStrongRoots(v);
       break;
+    case VISIT_ONLY_STRONG_FOR_PARALLEL_MARKING:
+      break;
     case VISIT_ALL_IN_SCAVENGE:
       isolate_->global_handles()->IterateNewSpaceStrongAndDependentRoots(v);
       break;
@@ -4005,7 +4198,7 @@ void Heap::IterateStrongRoots(RootVisitor* v, VisitMode mode) {
 
   // Iterate over eternal handles. Eternal handles are not iterated by the
   // serializer. Values referenced by eternal handles need to be added manually.
-  if (mode != VISIT_FOR_SERIALIZATION) {
+  if (mode != VISIT_FOR_SERIALIZATION && !isParallelMarking) {
     if (isMinorGC) {
       isolate_->eternal_handles()->IterateNewSpaceRoots(v);
     } else {
@@ -4134,6 +4327,14 @@ bool Heap::ConfigureHeap(size_t max_semi_space_size_in_kb,
   return true;
 }
 
+bool Heap::ConfigureYoungGenerationCollector(bool use_minor_mc) {
+  if (HasBeenSetUp()) return false;
+#ifdef ENABLE_MINOR_MC
+  use_minor_mc_ = use_minor_mc || FLAG_minor_mc;
+#endif  // ENABLE_MINOR_MC
+  return true;
+}
+
 
 void Heap::AddToRingBuffer(const char* string) {
   size_t first_part =
@@ -4655,6 +4856,9 @@ bool Heap::SetUp() {
   space_[LO_SPACE] = lo_space_ = new LargeObjectSpace(this, LO_SPACE);
   if (!lo_space_->SetUp()) return false;
 
+  space_[NEW_LO_SPACE] = new_lo_space_ = new NewLargeObjectSpace(this);
+  if (!new_lo_space_->SetUp()) return false;
+
   space_[RO_SPACE] = read_only_space_ =
       new ReadOnlySpace(this, RO_SPACE, NOT_EXECUTABLE);
   if (!read_only_space_->SetUp()) return false;
@@ -4675,6 +4879,11 @@ bool Heap::SetUp() {
   minor_mark_compact_collector_ = nullptr;
 #endif  // ENABLE_MINOR_MC
   array_buffer_collector_ = new ArrayBufferCollector(this);
+  if (FLAG_array_buffer_pool_size > 0 &&
+      isolate_->array_buffer_allocator() != nullptr) {
+    array_buffer_pool_ =
+        ArrayBufferPool::Acquire(isolate_->array_buffer_allocator());
+  }
   gc_idle_time_handler_ = new GCIdleTimeHandler();
   memory_reducer_ = new MemoryReducer(this);
   if (V8_UNLIKELY(FLAG_gc_stats)) {
@@ -4803,23 +5012,46 @@ void Heap::SetEmbedderHeapTracer(EmbedderHeapTracer* tracer) {
 
 void Heap::TracePossibleWrapper(JSObject* js_object) {
   DCHECK(js_object->WasConstructedFromApiFunction());
-  if (js_object->GetEmbedderFieldCount() >= 2 &&
-      js_object->GetEmbedderField(0) &&
-      js_object->GetEmbedderField(0) != undefined_value() &&
-      js_object->GetEmbedderField(1) != undefined_value()) {
-    DCHECK_EQ(0,
-              reinterpret_cast<intptr_t>(js_object->GetEmbedderField(0)) % 2);
-    local_embedder_heap_tracer()->AddWrapperToTrace(std::pair<void*, void*>(
-        reinterpret_cast<void*>(js_object->GetEmbedderField(0)),
-        reinterpret_cast<void*>(js_object->GetEmbedderField(1))));
+  std::pair<void*, void*> info;
+  if (ExtractWrapperInfo(js_object->map(), js_object, &info)) {
+    local_embedder_heap_tracer()->AddWrapperToTrace(info);
   }
 }
 
+bool Heap::ExtractWrapperInfo(Map* map, JSObject* js_object,
+                              std::pair<void*, void*>* info) {
+  if (JSObject::GetEmbedderFieldCount(map) < 2) return false;
+  int offset = JSObject::GetHeaderSize(map);
+  Object* first = RELAXED_READ_FIELD(js_object, offset);
+  Object* second = RELAXED_READ_FIELD(js_object, offset + kPointerSize);
+  if (first == nullptr || first == undefined_value() ||
+      second == undefined_value()) {
+    return false;
+  }
+  DCHECK_EQ(0, reinterpret_cast<intptr_t>(first) % 2);
+  *info = std::make_pair(reinterpret_cast<void*>(first),
+                         reinterpret_cast<void*>(second));
+  return true;
+}
+
 void Heap::RegisterExternallyReferencedObject(Object** object) {
   // The embedder is not aware of whether numbers are materialized as heap
   // objects are just passed around as Smis.
   if (!(*object)->IsHeapObject()) return;
   HeapObject* heap_object = HeapObject::cast(*object);
+  if (!isolate()->thread_id().Equals(ThreadId::Current())) {
+    // The embedder reports references from within TraceV8ReferencesConcurrently
+    // on a concurrent marking thread. The objects go into a single
+    // mutex-protected vector in LocalEmbedderHeapTracer that is shared by all
+    // marking tasks. A task drains it into the shared marking worklist after
+    // each call to the embedder.
+    DCHECK(local_embedder_heap_tracer()->IsConcurrentTracingEnabled());
+    if (incremental_marking()->marking_state()->WhiteToGrey(heap_object)) {
+      local_embedder_heap_tracer()->AddConcurrentlyDiscoveredObject(
+          heap_object);
+    }
+    return;
+  }
   DCHECK(Contains(heap_object));
   if (FLAG_incremental_marking_wrappers && incremental_marking()->IsMarking()) {
     incremental_marking()->WhiteToGreyAndPush(heap_object);
@@ -4914,6 +5146,16 @@ void Heap::TearDown() {
     dead_object_stats_ = nullptr;
   }
 
+  if (sampled_live_object_stats_ != nullptr) {
+    delete sampled_live_object_stats_;
+    sampled_live_object_stats_ = nullptr;
+  }
+
+  if (sampled_dead_object_stats_ != nullptr) {
+    delete sampled_dead_object_stats_;
+    sampled_dead_object_stats_ = nullptr;
+  }
+
   delete local_embedder_heap_tracer_;
   local_embedder_heap_tracer_ = nullptr;
 
@@ -4929,6 +5171,11 @@ void Heap::TearDown() {
   // store.
   ArrayBufferTracker::TearDown(this);
 
+  if (array_buffer_pool_ != nullptr) {
+    ArrayBufferPool::Release(array_buffer_pool_);
+    array_buffer_pool_ = nullptr;
+  }
+
   delete tracer_;
   tracer_ = nullptr;
 
@@ -4957,6 +5204,12 @@ void Heap::TearDown() {
     lo_space_ = nullptr;
   }
 
+  if (new_lo_space_ != nullptr) {
+    new_lo_space_->TearDown();
+    delete new_lo_space_;
+    new_lo_space_ = nullptr;
+  }
+
   if (read_only_space_ != nullptr) {
     delete read_only_space_;
     read_only_space_ = nullptr;
@@ -5561,6 +5814,48 @@ size_t Heap::ObjectSizeAtLastGC(size_t index) {
 }
 
 
+STATIC_ASSERT(v8::HeapObjectStatistics::kSizeBucketCount ==
+              ObjectStats::kNumberOfBuckets);
+
+size_t Heap::ObjectSizeHistogramAtLastGC(size_t index, size_t bucket) {
+  if (live_object_stats_ == nullptr ||
+      index >= ObjectStats::OBJECT_STATS_COUNT ||
+      bucket >= static_cast<size_t>(ObjectStats::kNumberOfBuckets))
+    return 0;
+  return live_object_stats_->size_histogram_last_gc(index,
+                                                     static_cast<int>(bucket));
+}
+
+
+size_t Heap::SampledObjectCountAtLastGC(size_t index) {
+  if (sampled_live_object_stats_ == nullptr ||
+      index >= ObjectStats::OBJECT_STATS_COUNT)
+    return 0;
+  return sampled_live_object_stats_->object_count_last_gc(index) *
+         object_stats_sampling_rate_;
+}
+
+
+size_t Heap::SampledObjectSizeAtLastGC(size_t index) {
+  if (sampled_live_object_stats_ == nullptr ||
+      index >= ObjectStats::OBJECT_STATS_COUNT)
+    return 0;
+  return sampled_live_object_stats_->object_size_last_gc(index) *
+         object_stats_sampling_rate_;
+}
+
+
+size_t Heap::SampledObjectSizeHistogramAtLastGC(size_t index, size_t bucket) {
+  if (sampled_live_object_stats_ == nullptr ||
+      index >= ObjectStats::OBJECT_STATS_COUNT ||
+      bucket >= static_cast<size_t>(ObjectStats::kNumberOfBuckets))
+    return 0;
+  return sampled_live_object_stats_->size_histogram_last_gc(
+             index, static_cast<int>(bucket)) *
+         object_stats_sampling_rate_;
+}
+
+
 bool Heap::GetObjectTypeName(size_t index, const char** object_type,
                              const char** object_sub_type) {
   if (index >= ObjectStats::OBJECT_STATS_COUNT) return false;
@@ -5613,6 +5908,8 @@ const char* AllocationSpaceName(AllocationSpace space) {
       return "MAP_SPACE";
     case LO_SPACE:
       return "LO_SPACE";
+    case NEW_LO_SPACE:
+      return "NEW_LO_SPACE";
     case RO_SPACE:
       return "RO_SPACE";
     default:
@@ -5686,6 +5983,7 @@ bool Heap::AllowedToBeMigrated(HeapObject* obj, AllocationSpace dst) {
       return dst == CODE_SPACE && type == CODE_TYPE;
     case MAP_SPACE:
     case LO_SPACE:
+    case NEW_LO_SPACE:
     case RO_SPACE:
       return false;
   }
@@ -5702,6 +6000,16 @@ void Heap::CreateObjectStats() {
   }
 }
 
+void Heap::CreateSampledObjectStats() {
+  if (V8_LIKELY(FLAG_object_stats_sampling_rate == 0)) return;
+  if (!sampled_live_object_stats_) {
+    sampled_live_object_stats_ = new ObjectStats(this);
+  }
+  if (!sampled_dead_object_stats_) {
+    sampled_dead_object_stats_ = new ObjectStats(this);
+  }
+}
+
 void AllocationObserver::AllocationStep(int bytes_allocated,
                                         Address soon_object, size_t size) {
   DCHECK_GE(bytes_allocated, 0);
@@ -423,6 +423,7 @@ using v8::MemoryPressureLevel;
 
 class AllocationObserver;
 class ArrayBufferCollector;
+class ArrayBufferPool;
 class ArrayBufferTracker;
 class ConcurrentMarking;
 class GCIdleTimeAction;
@@ -719,9 +720,9 @@ class Heap {
     return collector == SCAVENGER || collector == MINOR_MARK_COMPACTOR;
   }
 
-  static inline GarbageCollector YoungGenerationCollector() {
+  inline GarbageCollector YoungGenerationCollector() {
 #if ENABLE_MINOR_MC
-    return (FLAG_minor_mc) ? MINOR_MARK_COMPACTOR : SCAVENGER;
+    return use_minor_mc_ ? MINOR_MARK_COMPACTOR : SCAVENGER;
 #else
     return SCAVENGER;
 #endif  // ENABLE_MINOR_MC
@@ -887,6 +888,9 @@ class Heap {
   // Implements the corresponding V8 API function.
   bool IdleNotification(double deadline_in_seconds);
   bool IdleNotification(int idle_time_in_ms);
+  bool PerformIdleGarbageCollection(
+      double deadline_in_seconds, bool quiescent,
+      v8::IdleGarbageCollectionStatistics* statistics);
 
   void MemoryPressureNotification(MemoryPressureLevel level,
                                   bool is_isolate_locked);
@@ -987,6 +991,14 @@ class Heap {
                      size_t code_range_size_in_mb);
   bool ConfigureHeapDefault();
 
+  // Selects minor mark-compact instead of the scavenger as the young
+  // generation collector. --minor-mc enables it for all isolates. Has no
+  // effect if V8 was built without minor mark-compact support.
+  // Return false if the heap has been set up already.
+  bool ConfigureYoungGenerationCollector(bool use_minor_mc);
+
+  bool use_minor_mc() const { return use_minor_mc_; }
+
   // Prepares the heap, setting up memory areas that are needed in the isolate
   // without actually creating any objects.
   bool SetUp();
@@ -1001,6 +1013,10 @@ class Heap {
   // Create ObjectStats if live_object_stats_ or dead_object_stats_ are nullptr.
   void CreateObjectStats();
 
+  // Same as above for the statistics sampled with
+  // --object-stats-sampling-rate.
+  void CreateSampledObjectStats();
+
   // Sets the TearDown state, so no new GC tasks get posted.
   void StartTearDown();
 
@@ -1021,6 +1037,7 @@ class Heap {
   OldSpace* code_space() { return code_space_; }
   MapSpace* map_space() { return map_space_; }
   LargeObjectSpace* lo_space() { return lo_space_; }
+  NewLargeObjectSpace* new_lo_space() { return new_lo_space_; }
   ReadOnlySpace* read_only_space() { return read_only_space_; }
 
   inline PagedSpace* paged_space(int idx);
@@ -1051,6 +1068,9 @@ class Heap {
     return array_buffer_collector_;
   }
 
+  // Returns nullptr unless backing store pooling is enabled.
+  ArrayBufferPool* array_buffer_pool() { return array_buffer_pool_; }
+
   // ===========================================================================
   // Root set access. ==========================================================
   // ===========================================================================
@@ -1284,6 +1304,8 @@ class Heap {
 
   IncrementalMarking* incremental_marking() { return incremental_marking_; }
 
+  MemoryReducer* memory_reducer() { return memory_reducer_; }
+
   // ===========================================================================
   // Concurrent marking API. ===================================================
   // ===========================================================================
@@ -1334,6 +1356,10 @@ class Heap {
   }
   void SetEmbedderHeapTracer(EmbedderHeapTracer* tracer);
   void TracePossibleWrapper(JSObject* js_object);
+  // Reads the wrapper info of an API object if it has one. Safe to call from
+  // concurrent marking threads.
+  bool ExtractWrapperInfo(Map* map, JSObject* js_object,
+                          std::pair<void*, void*>* info);
   void RegisterExternallyReferencedObject(Object** object);
 
   // ===========================================================================
@@ -1365,6 +1391,10 @@ class Heap {
   // Returns whether the object resides in old space.
   inline bool InOldSpace(Object* object);
 
+  // Returns whether the object resides in the old or the young generation
+  // large object space.
+  inline bool IsLargeObject(HeapObject* object);
+
   // Checks whether an address/object in the heap (including auxiliary
   // area and unused area).
   bool Contains(HeapObject* value);
@@ -1394,6 +1424,15 @@ class Heap {
   // instance types.
   size_t ObjectCountAtLastGC(size_t index);
   size_t ObjectSizeAtLastGC(size_t index);
+  // Returns the number of objects in the given size bucket, see
+  // ObjectStats::HistogramIndexFromSize.
+  size_t ObjectSizeHistogramAtLastGC(size_t index, size_t bucket);
+
+  // Like the above, but estimated from the pages sampled at the last major GC
+  // when --object-stats-sampling-rate is set.
+  size_t SampledObjectCountAtLastGC(size_t index);
+  size_t SampledObjectSizeAtLastGC(size_t index);
+  size_t SampledObjectSizeHistogramAtLastGC(size_t index, size_t bucket);
 
   // Retrieves names of buckets used by object statistics tracking.
   bool GetObjectTypeName(size_t index, const char** object_type,
@@ -2014,8 +2053,18 @@ class Heap {
 
   // Performs a minor collection in new generation.
   void Scavenge();
+
+  // Frees empty old-to-new remembered set buckets after a young generation
+  // GC. With --concurrent-remembered-set-compaction, buckets of swept pages
+  // are freed on a background thread once the GC is over.
+  void FreeEmptyOldToNewBuckets();
   void EvacuateYoungGeneration();
 
+  // Moves the pages of young generation large objects that survived a
+  // scavenge to the old generation large object space.
+  void PromoteSurvivingNewLargeObjects(
+      const std::vector<std::pair<HeapObject*, Map*>>& objects);
+
   void UpdateNewSpaceReferencesInExternalStringTable(
       ExternalStringTableUpdaterCallback updater_func);
 
@@ -2238,6 +2287,7 @@ class Heap {
   OldSpace* code_space_;
   MapSpace* map_space_;
   LargeObjectSpace* lo_space_;
+  NewLargeObjectSpace* new_lo_space_;
   ReadOnlySpace* read_only_space_;
   // Map from the space id to the space.
   Space* space_[LAST_SPACE + 1];
@@ -2354,6 +2404,8 @@ class Heap {
 
   ArrayBufferCollector* array_buffer_collector_;
 
+  ArrayBufferPool* array_buffer_pool_;
+
   MemoryAllocator* memory_allocator_;
 
   StoreBuffer* store_buffer_;
@@ -2368,6 +2420,11 @@ class Heap {
   ObjectStats* live_object_stats_;
   ObjectStats* dead_object_stats_;
 
+  ObjectStats* sampled_live_object_stats_;
+  ObjectStats* sampled_dead_object_stats_;
+  // The sampling rate the sampled statistics were collected with.
+  int object_stats_sampling_rate_;
+
   ScavengeJob* scavenge_job_;
   base::Semaphore parallel_scavenge_semaphore_;
 
@@ -2432,6 +2489,9 @@ class Heap {
 
   bool fast_promotion_mode_;
 
+  // Whether minor mark-compact is used as young generation collector.
+  bool use_minor_mc_;
+
   // Used for testing purposes.
   bool force_oom_;
   bool delay_sweeper_tasks_for_testing_;
@@ -2476,6 +2536,7 @@ class Heap {
   friend class MarkCompactCollector;
   friend class MarkCompactCollectorBase;
   friend class MinorMarkCompactCollector;
+  friend class NewLargeObjectSpace;
   friend class NewSpace;
   friend class ObjectStatsCollector;
   friend class Page;
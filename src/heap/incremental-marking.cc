@@ -275,6 +275,10 @@ void IncrementalMarking::DeactivateIncrementalWriteBarrier() {
   for (LargePage* lop : *heap_->lo_space()) {
     SetOldSpacePageFlags(lop, false, false);
   }
+
+  for (LargePage* lop : *heap_->new_lo_space()) {
+    SetNewSpacePageFlags(lop, false);
+  }
 }
 
 
@@ -301,6 +305,10 @@ void IncrementalMarking::ActivateIncrementalWriteBarrier() {
   for (LargePage* lop : *heap_->lo_space()) {
     SetOldSpacePageFlags(lop, true, is_compacting_);
   }
+
+  for (LargePage* lop : *heap_->new_lo_space()) {
+    SetNewSpacePageFlags(lop, true);
+  }
 }
 
 
@@ -677,6 +685,22 @@ void IncrementalMarking::UpdateWeakReferencesAfterScavenge() {
         *slot_out = slot_in;
         return true;
       });
+  weak_objects_->weak_collections.Update(
+      [](JSWeakCollection* collection_in,
+         JSWeakCollection** collection_out) -> bool {
+        MapWord map_word = collection_in->map_word();
+        if (map_word.IsForwardingAddress()) {
+          *collection_out =
+              JSWeakCollection::cast(map_word.ToForwardingAddress());
+          return true;
+        }
+        if (collection_in->GetHeap()->InFromSpace(collection_in)) {
+          // The weak collection died in the scavenge.
+          return false;
+        }
+        *collection_out = collection_in;
+        return true;
+      });
   weak_objects_->weak_objects_in_code.Update(
       [](std::pair<HeapObject*, Code*> slot_in,
          std::pair<HeapObject*, Code*>* slot_out) -> bool {
@@ -736,7 +760,8 @@ void IncrementalMarking::RevisitObject(HeapObject* obj) {
   DCHECK(IsMarking());
   DCHECK(FLAG_concurrent_marking || marking_state()->IsBlack(obj));
   Page* page = Page::FromAddress(obj->address());
-  if (page->owner()->identity() == LO_SPACE) {
+  if (page->owner()->identity() == LO_SPACE ||
+      page->owner()->identity() == NEW_LO_SPACE) {
     page->ResetProgressBar();
   }
   Map* map = obj->map();
@@ -89,11 +89,10 @@ template <FixedArrayVisitationMode fixed_array_mode,
           TraceRetainingPathMode retaining_path_mode, typename MarkingState>
 int MarkingVisitor<fixed_array_mode, retaining_path_mode, MarkingState>::
     VisitJSWeakCollection(Map* map, JSWeakCollection* weak_collection) {
-  // Enqueue weak collection in linked list of encountered weak collections.
-  if (weak_collection->next() == heap_->undefined_value()) {
-    weak_collection->set_next(heap_->encountered_weak_collections());
-    heap_->set_encountered_weak_collections(weak_collection);
-  }
+  // Enqueue weak collection for scanning of its backing table in the atomic
+  // pause.
+  collector_->weak_objects()->weak_collections.Push(
+      MarkCompactCollector::kMainThread, weak_collection);
 
   // Skip visiting the backing hash table containing the mappings and the
   // pointer to the other enqueued weak collections, both are post-processed.
@@ -293,7 +292,8 @@ int MarkingVisitor<fixed_array_mode, retaining_path_mode, MarkingState>::
   int object_size = FixedArray::BodyDescriptor::SizeOf(map, object);
   if (chunk->IsFlagSet(MemoryChunk::HAS_PROGRESS_BAR)) {
     DCHECK(!FLAG_use_marking_progress_bar ||
-           chunk->owner()->identity() == LO_SPACE);
+           chunk->owner()->identity() == LO_SPACE ||
+           chunk->owner()->identity() == NEW_LO_SPACE);
     // When using a progress bar for large fixed arrays, scan only a chunk of
     // the array and try to push it onto the marking deque again until it is
     // fully scanned. Fall back to scanning it through to the end in case this
@@ -28,6 +28,7 @@
 #include "src/heap/sweeper.h"
 #include "src/heap/worklist.h"
 #include "src/ic/stub-cache.h"
+#include "src/interpreter/interpreter.h"
 #include "src/transitions-inl.h"
 #include "src/utils-inl.h"
 #include "src/v8.h"
@@ -432,6 +433,7 @@ MarkCompactCollector::MarkCompactCollector(Heap* heap)
       was_marked_incrementally_(false),
       evacuation_(false),
       compacting_(false),
+      evacuation_pause_budget_(kNoEvacuationPauseBudget),
       black_allocation_(false),
       have_code_to_deoptimize_(false),
       marking_worklist_(heap),
@@ -476,6 +478,19 @@ bool MarkCompactCollector::StartCompaction() {
   if (!compacting_) {
     DCHECK(evacuation_candidates_.empty());
 
+    // Size the budget such that the whole evacuation pause, including
+    // pointer updating, stays within the target. At least one page worth of
+    // objects is allowed to make progress on fragmentation.
+    evacuation_pause_budget_ = kNoEvacuationPauseBudget;
+    const double evacuation_pause_speed =
+        heap()->tracer()->EvacuationPauseSpeedInBytesPerMillisecond();
+    if (FLAG_compaction_pause_target_ms > 0 && evacuation_pause_speed != 0) {
+      evacuation_pause_budget_ =
+          Max(static_cast<size_t>(heap()->old_space()->AreaSize()),
+              static_cast<size_t>(evacuation_pause_speed *
+                                  FLAG_compaction_pause_target_ms));
+    }
+
     CollectEvacuationCandidates(heap()->old_space());
 
     if (FLAG_compact_code_space) {
@@ -555,6 +570,14 @@ void MarkCompactCollector::VerifyMarkbitsAreClean() {
     CHECK_EQ(0, non_atomic_marking_state()->live_bytes(
                     MemoryChunk::FromAddress(obj->address())));
   }
+
+  LargeObjectIterator new_lo_it(heap_->new_lo_space());
+  for (HeapObject* obj = new_lo_it.Next(); obj != nullptr;
+       obj = new_lo_it.Next()) {
+    CHECK(non_atomic_marking_state()->IsWhite(obj));
+    CHECK_EQ(0, non_atomic_marking_state()->live_bytes(
+                    MemoryChunk::FromAddress(obj->address())));
+  }
 }
 
 #endif  // VERIFY_HEAP
@@ -578,6 +601,7 @@ void MarkCompactCollector::ClearMarkbits() {
   ClearMarkbitsInPagedSpace(heap_->old_space());
   ClearMarkbitsInNewSpace(heap_->new_space());
   heap_->lo_space()->ClearMarkingStateOfLiveObjects();
+  heap_->new_lo_space()->ClearMarkingStateOfLiveObjects();
 }
 
 void MarkCompactCollector::EnsureSweepingCompleted() {
@@ -641,6 +665,10 @@ void MarkCompactCollector::ComputeEvacuationHeuristics(
       *target_fragmentation_percent = kTargetFragmentationPercent;
     }
     *max_evacuated_bytes = kMaxEvacuatedBytes;
+    if (evacuation_pause_budget_ != kNoEvacuationPauseBudget) {
+      // What is left of the pause target after previously compacted spaces.
+      *max_evacuated_bytes = evacuation_pause_budget_;
+    }
   }
 }
 
@@ -774,6 +802,11 @@ void MarkCompactCollector::CollectEvacuationCandidates(PagedSpace* space) {
     for (int i = 0; i < candidate_count; i++) {
       AddEvacuationCandidate(pages[i].second);
     }
+    if (evacuation_pause_budget_ != kNoEvacuationPauseBudget &&
+        candidate_count > 0) {
+      evacuation_pause_budget_ -=
+          Min(evacuation_pause_budget_, total_live_bytes);
+    }
   }
 
   if (FLAG_trace_fragmentation) {
@@ -1150,10 +1183,10 @@ class RecordMigratedSlotVisitor : public ObjectVisitor {
         DCHECK_IMPLIES(p->InToSpace(),
                        p->IsFlagSet(Page::PAGE_NEW_NEW_PROMOTION));
         RememberedSet<OLD_TO_NEW>::Insert<AccessMode::NON_ATOMIC>(
-            Page::FromAddress(slot), slot);
+            MemoryChunk::FromHeapObject(host), slot);
       } else if (p->IsEvacuationCandidate()) {
         RememberedSet<OLD_TO_OLD>::Insert<AccessMode::NON_ATOMIC>(
-            Page::FromAddress(slot), slot);
+            MemoryChunk::FromHeapObject(host), slot);
       }
     }
   }
@@ -1491,11 +1524,157 @@ void MarkCompactCollector::MarkStringTable(
   }
 }
 
+// A part of the strong root set that can be visited off the main thread.
+class ParallelRootMarkingItem : public ItemParallelJob::Item {
+ public:
+  enum Kind { kBuiltins, kCompilationCache, kEternalHandles, kGlobalHandles };
+
+  explicit ParallelRootMarkingItem(Kind kind) : kind_(kind), blocks_() {
+    DCHECK_NE(kGlobalHandles, kind);
+  }
+  explicit ParallelRootMarkingItem(
+      const GlobalHandles::UsedNodeBlockRange& blocks)
+      : kind_(kGlobalHandles), blocks_(blocks) {}
+  virtual ~ParallelRootMarkingItem() {}
+
+  void Process(Isolate* isolate, RootVisitor* visitor) {
+    TRACE_EVENT0(TRACE_DISABLED_BY_DEFAULT("v8.gc"),
+                 "ParallelRootMarkingItem::Process");
+    switch (kind_) {
+      case kBuiltins:
+        isolate->builtins()->IterateBuiltins(visitor);
+        isolate->interpreter()->IterateDispatchTable(visitor);
+        break;
+      case kCompilationCache:
+        isolate->compilation_cache()->Iterate(visitor);
+        break;
+      case kEternalHandles:
+        isolate->eternal_handles()->IterateAllRoots(visitor);
+        break;
+      case kGlobalHandles:
+        isolate->global_handles()->IterateStrongRoots(visitor, blocks_);
+        break;
+    }
+  }
+
+ private:
+  Kind kind_;
+  // Range of global handle node blocks.
+  GlobalHandles::UsedNodeBlockRange blocks_;
+};
+
+class ParallelRootMarkingTask : public ItemParallelJob::Task {
+ public:
+  using RootWorklist =
+      MarkCompactCollector::MarkingWorklist::ConcurrentMarkingWorklist;
+
+  ParallelRootMarkingTask(Isolate* isolate, MarkCompactCollector* collector,
+                          RootWorklist* worklist, int task_id)
+      : ItemParallelJob::Task(isolate),
+        isolate_(isolate),
+        collector_(collector),
+        worklist_(worklist),
+        task_id_(task_id) {}
+
+  void RunInParallel() override {
+    TRACE_BACKGROUND_GC(collector_->heap()->tracer(),
+                        GCTracer::BackgroundScope::MC_BACKGROUND_MARKING);
+    RootVisitor visitor(collector_->marking_state(), worklist_, task_id_);
+    ParallelRootMarkingItem* item = nullptr;
+    while ((item = GetItem<ParallelRootMarkingItem>()) != nullptr) {
+      item->Process(isolate_, &visitor);
+      item->MarkFinished();
+    }
+    worklist_->FlushToGlobal(task_id_);
+  }
+
+ private:
+  class RootVisitor final : public v8::internal::RootVisitor {
+   public:
+    RootVisitor(MarkCompactCollector::MarkingState* marking_state,
+                RootWorklist* worklist, int task_id)
+        : marking_state_(marking_state), worklist_(worklist, task_id) {}
+
+    void VisitRootPointer(Root root, const char* description,
+                          Object** p) final {
+      MarkObjectByPointer(p);
+    }
+
+    void VisitRootPointers(Root root, const char* description, Object** start,
+                           Object** end) final {
+      for (Object** p = start; p < end; p++) MarkObjectByPointer(p);
+    }
+
+   private:
+    V8_INLINE void MarkObjectByPointer(Object** p) {
+      if (!(*p)->IsHeapObject()) return;
+      HeapObject* object = HeapObject::cast(*p);
+      if (marking_state_->WhiteToGrey(object)) {
+        bool success = worklist_.Push(object);
+        USE(success);
+        DCHECK(success);
+      }
+    }
+
+    MarkCompactCollector::MarkingState* marking_state_;
+    RootWorklist::View worklist_;
+  };
+
+  Isolate* isolate_;
+  MarkCompactCollector* collector_;
+  RootWorklist* worklist_;
+  int task_id_;
+};
+
+void MarkCompactCollector::MarkRootsInParallel() {
+  // A node block holds 256 global handles.
+  const size_t kGlobalHandleBlocksPerItem = 16;
+  ItemParallelJob job(isolate()->cancelable_task_manager(),
+                      &page_parallel_job_semaphore_);
+  job.AddItem(
+      new ParallelRootMarkingItem(ParallelRootMarkingItem::kBuiltins));
+  job.AddItem(
+      new ParallelRootMarkingItem(ParallelRootMarkingItem::kCompilationCache));
+  job.AddItem(
+      new ParallelRootMarkingItem(ParallelRootMarkingItem::kEternalHandles));
+  for (const GlobalHandles::UsedNodeBlockRange& blocks :
+       isolate()->global_handles()->PartitionUsedNodeBlocks(
+           kGlobalHandleBlocksPerItem)) {
+    job.AddItem(new ParallelRootMarkingItem(blocks));
+  }
+
+  const int num_tasks =
+      Min(Min(NumberOfAvailableCores(), job.NumberOfItems()),
+          ParallelRootMarkingTask::RootWorklist::kMaxNumTasks);
+  ParallelRootMarkingTask::RootWorklist root_worklist(num_tasks);
+  for (int i = 0; i < num_tasks; i++) {
+    job.AddTask(
+        new ParallelRootMarkingTask(isolate(), this, &root_worklist, i));
+  }
+  job.Run(isolate()->async_counters());
+  marking_worklist()->shared()->MergeGlobalPool(&root_worklist);
+}
+
 void MarkCompactCollector::MarkRoots(RootVisitor* root_visitor,
                                      ObjectVisitor* custom_root_body_visitor) {
   // Mark the heap roots including global variables, stack variables,
   // etc., and all objects reachable from them.
-  heap()->IterateStrongRoots(root_visitor, VISIT_ONLY_STRONG);
+  // Heap::AddRetainingRoot is not thread-safe, so tracking retaining paths
+  // needs the sequential root marking.
+  bool parallel_root_marking = FLAG_parallel_marking &&
+                               FLAG_parallel_root_marking &&
+                               !FLAG_track_retaining_path;
+#ifndef V8_CONCURRENT_MARKING
+  // Parallel root marking relies on atomic mark bits.
+  parallel_root_marking = false;
+#endif
+  if (parallel_root_marking) {
+    heap()->IterateStrongRoots(root_visitor,
+                               VISIT_ONLY_STRONG_FOR_PARALLEL_MARKING);
+    MarkRootsInParallel();
+  } else {
+    heap()->IterateStrongRoots(root_visitor, VISIT_ONLY_STRONG);
+  }
 
   // Custom marking for string table and top optimized frame.
   MarkStringTable(custom_root_body_visitor);
@@ -1520,6 +1699,7 @@ void MarkCompactCollector::ProcessMarkingWorklist() {
 
 void MarkCompactCollector::ProcessEphemeralMarking() {
   DCHECK(marking_worklist()->IsEmpty());
+  int iterations = 0;
   bool work_to_do = true;
   while (work_to_do) {
     if (heap_->local_embedder_heap_tracer()->InUse()) {
@@ -1529,9 +1709,18 @@ void MarkCompactCollector::ProcessEphemeralMarking() {
           0, EmbedderHeapTracer::AdvanceTracingActions(
                  EmbedderHeapTracer::ForceCompletionAction::FORCE_COMPLETION));
     }
-    ProcessWeakCollections();
-    work_to_do = !marking_worklist()->IsEmpty();
-    ProcessMarkingWorklist();
+    if (iterations < FLAG_ephemeron_fixpoint_iterations) {
+      ProcessEphemerons();
+      ProcessWeakCollections();
+      work_to_do = !marking_worklist()->IsEmpty();
+      ProcessMarkingWorklist();
+    } else {
+      // Long chains of ephemerons (e.g. a value that is the key of another
+      // entry) need one round per link. Switch to the linear algorithm.
+      ProcessWeakCollections();
+      work_to_do = ProcessEphemeronsLinear();
+    }
+    iterations++;
   }
   CHECK(marking_worklist()->IsEmpty());
   CHECK_EQ(0, heap()->local_embedder_heap_tracer()->NumberOfWrappersToTrace());
@@ -1576,6 +1765,17 @@ void MarkCompactCollector::RecordObjectStats() {
     heap()->live_object_stats_->CheckpointObjectStats();
     heap()->dead_object_stats_->ClearObjectStats();
   }
+  if (V8_UNLIKELY(FLAG_object_stats_sampling_rate > 0)) {
+    heap()->CreateSampledObjectStats();
+    ObjectStatsCollector collector(heap(), heap()->sampled_live_object_stats_,
+                                   heap()->sampled_dead_object_stats_);
+    // Rotate the sampled pages from one GC to the next.
+    collector.CollectSampled(FLAG_object_stats_sampling_rate,
+                             heap()->ms_count());
+    heap()->sampled_live_object_stats_->CheckpointObjectStats();
+    heap()->sampled_dead_object_stats_->ClearObjectStats();
+    heap()->object_stats_sampling_rate_ = FLAG_object_stats_sampling_rate;
+  }
 }
 
 void MarkCompactCollector::MarkLiveObjects() {
@@ -1728,6 +1928,9 @@ void MarkCompactCollector::ClearNonLiveReferences() {
   DCHECK(weak_objects_.transition_arrays.IsGlobalEmpty());
   DCHECK(weak_objects_.weak_references.IsGlobalEmpty());
   DCHECK(weak_objects_.weak_objects_in_code.IsGlobalEmpty());
+  DCHECK(weak_objects_.weak_collections.IsGlobalEmpty());
+  DCHECK(weak_objects_.current_ephemerons.IsGlobalEmpty());
+  DCHECK(weak_objects_.next_ephemerons.IsGlobalEmpty());
 }
 
 void MarkCompactCollector::MarkDependentCodeForDeoptimization() {
@@ -1899,37 +2102,103 @@ void MarkCompactCollector::TrimEnumCache(Map* map,
 }
 
 void MarkCompactCollector::ProcessWeakCollections() {
-  MarkCompactMarkingVisitor visitor(this, marking_state());
-  Object* weak_collection_obj = heap()->encountered_weak_collections();
-  while (weak_collection_obj != Smi::kZero) {
-    JSWeakCollection* weak_collection =
-        reinterpret_cast<JSWeakCollection*>(weak_collection_obj);
+  JSWeakCollection* weak_collection;
+  while (weak_objects_.weak_collections.Pop(kMainThread, &weak_collection)) {
+    // A collection can be pushed more than once, e.g. by the main thread and
+    // by a concurrent marker. Only the first occurrence is scanned.
+    if (weak_collection->next() != heap()->undefined_value()) continue;
+    weak_collection->set_next(heap()->encountered_weak_collections());
+    heap()->set_encountered_weak_collections(weak_collection);
     DCHECK(non_atomic_marking_state()->IsBlackOrGrey(weak_collection));
-    if (weak_collection->table()->IsHashTable()) {
-      ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
-      for (int i = 0; i < table->Capacity(); i++) {
-        HeapObject* heap_object = HeapObject::cast(table->KeyAt(i));
-        if (non_atomic_marking_state()->IsBlackOrGrey(heap_object)) {
-          Object** key_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToIndex(i));
-          RecordSlot(table, key_slot, *key_slot);
-          Object** value_slot =
-              table->RawFieldOfElementAt(ObjectHashTable::EntryToValueIndex(i));
-          if (V8_UNLIKELY(FLAG_track_retaining_path) &&
-              (*value_slot)->IsHeapObject()) {
-            heap()->AddEphemeralRetainer(heap_object,
-                                         HeapObject::cast(*value_slot));
-          }
-          visitor.VisitPointer(table, value_slot);
-        }
+    if (!weak_collection->table()->IsHashTable()) continue;
+    ObjectHashTable* table = ObjectHashTable::cast(weak_collection->table());
+    for (int i = 0; i < table->Capacity(); i++) {
+      Ephemeron ephemeron = {table, i};
+      if (!ProcessEphemeron(ephemeron)) {
+        weak_objects_.current_ephemerons.Push(kMainThread, ephemeron);
       }
     }
-    weak_collection_obj = weak_collection->next();
   }
 }
 
+bool MarkCompactCollector::ProcessEphemeron(const Ephemeron& ephemeron) {
+  ObjectHashTable* table = ephemeron.table;
+  HeapObject* key = HeapObject::cast(table->KeyAt(ephemeron.entry));
+  if (!non_atomic_marking_state()->IsBlackOrGrey(key)) return false;
+  Object** key_slot = table->RawFieldOfElementAt(
+      ObjectHashTable::EntryToIndex(ephemeron.entry));
+  RecordSlot(table, key_slot, key);
+  Object** value_slot = table->RawFieldOfElementAt(
+      ObjectHashTable::EntryToValueIndex(ephemeron.entry));
+  if ((*value_slot)->IsHeapObject()) {
+    HeapObject* value = HeapObject::cast(*value_slot);
+    if (V8_UNLIKELY(FLAG_track_retaining_path)) {
+      heap()->AddEphemeralRetainer(key, value);
+    }
+    RecordSlot(table, value_slot, value);
+    MarkObject(table, value);
+  }
+  return true;
+}
+
+void MarkCompactCollector::ProcessEphemerons() {
+  Ephemeron ephemeron;
+  while (weak_objects_.current_ephemerons.Pop(kMainThread, &ephemeron)) {
+    if (!ProcessEphemeron(ephemeron)) {
+      weak_objects_.next_ephemerons.Push(kMainThread, ephemeron);
+    }
+  }
+  weak_objects_.next_ephemerons.FlushToGlobal(kMainThread);
+  weak_objects_.current_ephemerons.MergeGlobalPool(
+      &weak_objects_.next_ephemerons);
+}
+
+bool MarkCompactCollector::ProcessEphemeronsLinear() {
+  std::unordered_multimap<HeapObject*, Ephemeron> key_to_ephemerons;
+  Ephemeron ephemeron;
+  while (weak_objects_.current_ephemerons.Pop(kMainThread, &ephemeron)) {
+    if (!ProcessEphemeron(ephemeron)) {
+      HeapObject* key =
+          HeapObject::cast(ephemeron.table->KeyAt(ephemeron.entry));
+      key_to_ephemerons.emplace(key, ephemeron);
+    }
+  }
+
+  bool work_done = false;
+  HeapObject* object;
+  MarkCompactMarkingVisitor visitor(this, marking_state());
+  while ((object = marking_worklist()->Pop()) != nullptr) {
+    work_done = true;
+    DCHECK(!object->IsFiller());
+    DCHECK(heap()->Contains(object));
+    DCHECK(!(marking_state()->IsWhite(object)));
+    marking_state()->GreyToBlack(object);
+    Map* map = object->map();
+    MarkObject(object, map);
+    visitor.Visit(map, object);
+    if (key_to_ephemerons.empty()) continue;
+    auto range = key_to_ephemerons.equal_range(object);
+    for (auto it = range.first; it != range.second; ++it) {
+      bool key_is_marked = ProcessEphemeron(it->second);
+      USE(key_is_marked);
+      DCHECK(key_is_marked);
+    }
+    key_to_ephemerons.erase(range.first, range.second);
+  }
+  DCHECK(marking_worklist()->IsBailoutEmpty());
+
+  // Keys that were marked without being pushed are caught by the next call,
+  // which revisits all remaining ephemerons first.
+  for (auto& pair : key_to_ephemerons) {
+    weak_objects_.current_ephemerons.Push(kMainThread, pair.second);
+  }
+  return work_done;
+}
+
 void MarkCompactCollector::ClearWeakCollections() {
   TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_CLEAR_WEAK_COLLECTIONS);
+  // Entries with unmarked keys are removed below.
+  weak_objects_.current_ephemerons.Clear();
   Object* weak_collection_obj = heap()->encountered_weak_collections();
   while (weak_collection_obj != Smi::kZero) {
     JSWeakCollection* weak_collection =
@@ -2028,6 +2297,9 @@ void MarkCompactCollector::AbortWeakObjects() {
   weak_objects_.transition_arrays.Clear();
   weak_objects_.weak_references.Clear();
   weak_objects_.weak_objects_in_code.Clear();
+  weak_objects_.weak_collections.Clear();
+  weak_objects_.current_ephemerons.Clear();
+  weak_objects_.next_ephemerons.Clear();
 }
 
 void MarkCompactCollector::RecordRelocSlot(Code* host, RelocInfo* rinfo,
@@ -2206,6 +2478,8 @@ void MarkCompactCollector::EvacuateEpilogue() {
   heap()->new_space()->set_age_mark(heap()->new_space()->top());
   // Deallocate unmarked large objects.
   heap()->lo_space()->FreeUnmarkedObjects();
+  // Live young generation large objects have been promoted already.
+  heap()->new_lo_space()->FreeAllObjects();
   // Old space. Deallocate evacuated candidate pages.
   ReleaseEvacuationCandidates();
   // Give pages that are queued to be freed back to the OS.
@@ -2530,14 +2804,41 @@ void MarkCompactCollector::EvacuatePagesInParallel() {
     }
     evacuation_job.AddItem(new PageEvacuationItem(page));
   }
-  if (evacuation_job.NumberOfItems() == 0) return;
 
   RecordMigratedSlotVisitor record_visitor(this);
+  PromoteNewLargeObjects(&record_visitor);
+
+  if (evacuation_job.NumberOfItems() == 0) return;
+
   CreateAndExecuteEvacuationTasks<FullEvacuator>(
       this, &evacuation_job, &record_visitor, nullptr, live_bytes);
   PostProcessEvacuationCandidates();
 }
 
+void MarkCompactCollector::PromoteNewLargeObjects(
+    RecordMigratedSlotVisitor* record_visitor) {
+  NewLargeObjectSpace* new_lo_space = heap()->new_lo_space();
+  if (new_lo_space->IsEmpty()) return;
+  std::vector<HeapObject*> promoted_objects;
+  for (auto it = new_lo_space->begin(); it != new_lo_space->end();) {
+    LargePage* current = *it;
+    ++it;
+    HeapObject* object = current->GetObject();
+    DCHECK(!non_atomic_marking_state()->IsGrey(object));
+    if (non_atomic_marking_state()->IsBlack(object)) {
+      heap()->lo_space()->PromoteNewLargeObject(current);
+      promoted_objects.push_back(object);
+    }
+  }
+  // Slots of young generation objects are not recorded during marking. Record
+  // them once all surviving large objects have left the young generation so
+  // that only pointers to regular new space objects end up in the old to new
+  // remembered set.
+  for (HeapObject* object : promoted_objects) {
+    object->IterateBodyFast(record_visitor);
+  }
+}
+
 class EvacuationWeakObjectRetainer : public WeakObjectRetainer {
  public:
   virtual Object* RetainAs(Object* object) {
@@ -2651,6 +2952,12 @@ void MarkCompactCollector::Evacuate() {
     EvacuatePrologue();
   }
 
+  size_t old_space_live_bytes = 0;
+  for (Page* page : old_space_evacuation_pages_) {
+    old_space_live_bytes += non_atomic_marking_state()->live_bytes(page);
+  }
+  const double evacuation_start = heap()->MonotonicallyIncreasingTimeInMs();
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_EVACUATE_COPY);
     EvacuationScope evacuation_scope(this);
@@ -2659,6 +2966,12 @@ void MarkCompactCollector::Evacuate() {
 
   UpdatePointersAfterEvacuation();
 
+  if (old_space_live_bytes > 0) {
+    heap()->tracer()->AddEvacuationPauseEvent(
+        heap()->MonotonicallyIncreasingTimeInMs() - evacuation_start,
+        old_space_live_bytes);
+  }
+
   {
     TRACE_GC(heap()->tracer(), GCTracer::Scope::MC_EVACUATE_REBALANCE);
     if (!heap()->new_space()->Rebalance()) {
@@ -3513,6 +3826,20 @@ int MinorMarkCompactCollector::NumberOfParallelMarkingTasks(int pages) {
   return Min(NumberOfAvailableCores(), Min(wanted_tasks, kNumMarkers));
 }
 
+bool MinorMarkCompactCollector::ShouldPromotePage(Page* p,
+                                                  intptr_t live_bytes) {
+  if (!ShouldMovePage(p, live_bytes)) return false;
+  // Promoted pages keep their dead objects until the next full GC. When
+  // optimizing for memory usage only pages that are almost entirely live are
+  // promoted, survivors on all other pages are compacted by copying.
+  if (heap()->ShouldOptimizeForMemoryUsage()) {
+    const int kMemoryReducingPagePromotionThreshold = 90;
+    return live_bytes > kMemoryReducingPagePromotionThreshold *
+                            Page::kAllocatableMemory / 100;
+  }
+  return true;
+}
+
 void MinorMarkCompactCollector::CleanupSweepToIteratePages() {
   for (Page* p : sweep_to_iterate_pages_) {
     if (p->IsFlagSet(Page::SWEEP_TO_ITERATE)) {
@@ -3722,14 +4049,7 @@ void MinorMarkCompactCollector::CollectGarbage() {
     }
   }
 
-  RememberedSet<OLD_TO_NEW>::IterateMemoryChunks(
-      heap(), [](MemoryChunk* chunk) {
-        if (chunk->SweepingDone()) {
-          RememberedSet<OLD_TO_NEW>::FreeEmptyBuckets(chunk);
-        } else {
-          RememberedSet<OLD_TO_NEW>::PreFreeEmptyBuckets(chunk);
-        }
-      });
+  heap()->FreeEmptyOldToNewBuckets();
 
   heap()->account_external_memory_concurrently_freed();
 }
@@ -4332,7 +4652,7 @@ void MinorMarkCompactCollector::EvacuatePagesInParallel() {
     intptr_t live_bytes_on_page = non_atomic_marking_state()->live_bytes(page);
     if (live_bytes_on_page == 0 && !page->contains_array_buffers()) continue;
     live_bytes += live_bytes_on_page;
-    if (ShouldMovePage(page, live_bytes_on_page)) {
+    if (ShouldPromotePage(page, live_bytes_on_page)) {
       if (page->IsFlagSet(MemoryChunk::NEW_SPACE_BELOW_AGE_MARK)) {
         EvacuateNewSpacePageVisitor<NEW_TO_OLD>::Move(page);
       } else {
@@ -421,6 +421,14 @@ class MajorNonAtomicMarkingState final
   }
 };
 
+// An entry of a weak collection's backing table whose key was not known to be
+// live when the entry was last looked at. The value is marked as soon as the
+// key is found to be live.
+struct Ephemeron {
+  ObjectHashTable* table;
+  int entry;
+};
+
 // Weak objects encountered during marking.
 struct WeakObjects {
   Worklist<WeakCell*, 64> weak_cells;
@@ -429,6 +437,14 @@ struct WeakObjects {
   // object. Optimize this by adding a different storage for old space.
   Worklist<std::pair<HeapObject*, HeapObjectReference**>, 64> weak_references;
   Worklist<std::pair<HeapObject*, Code*>, 64> weak_objects_in_code;
+  // Weak collections whose backing tables have not been scanned yet. Both the
+  // main thread and the concurrent markers push here; the tables are scanned
+  // on the main thread in the atomic pause.
+  Worklist<JSWeakCollection*, 64> weak_collections;
+  // Ephemerons with unmarked keys. Only used on the main thread in the atomic
+  // pause; |next_ephemerons| collects the leftovers of a fixpoint round.
+  Worklist<Ephemeron, 64> current_ephemerons;
+  Worklist<Ephemeron, 64> next_ephemerons;
 };
 
 // Collector for young and old generation.
@@ -698,6 +714,11 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void MarkRoots(RootVisitor* root_visitor,
                  ObjectVisitor* custom_root_body_visitor);
 
+  // Marks global handles, eternal handles, the compilation cache, and
+  // builtins on parallel tasks. The marked objects end up in the global pool
+  // of the shared marking worklist, where concurrent markers can steal them.
+  void MarkRootsInParallel();
+
   // Mark the string table specially.  References to internalized strings from
   // the string table are weak.
   void MarkStringTable(ObjectVisitor* visitor);
@@ -738,11 +759,27 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void TrimDescriptorArray(Map* map, DescriptorArray* descriptors);
   void TrimEnumCache(Map* map, DescriptorArray* descriptors);
 
-  // Mark all values associated with reachable keys in weak collections
-  // encountered so far.  This might push new object or even new weak maps onto
-  // the marking stack.
+  // Links the weak collections discovered since the last call into the list
+  // of encountered weak collections and scans their backing tables once.
+  // Values of reachable keys are marked, the remaining entries are queued as
+  // ephemerons. This might push new objects or even new weak maps onto the
+  // marking stack.
   void ProcessWeakCollections();
 
+  // Marks the value of the given ephemeron and returns true if its key is
+  // marked. Returns false otherwise.
+  bool ProcessEphemeron(const Ephemeron& ephemeron);
+
+  // Runs one fixpoint round over the queued ephemerons. Only the entries with
+  // unmarked keys are revisited, not the whole backing tables.
+  void ProcessEphemerons();
+
+  // Drains the marking worklist while looking up each marked object in a
+  // key-to-ephemerons map of the queued ephemerons. Linear in the number of
+  // ephemerons, used when the fixpoint rounds do not converge quickly. Returns
+  // true if any object was marked.
+  bool ProcessEphemeronsLinear();
+
   // After all reachable objects have been marked those weak map entries
   // with an unreachable key are removed from all encountered weak maps.
   // The linked list of all encountered weak maps is destroyed.
@@ -771,6 +808,10 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   void EvacuatePagesInParallel() override;
   void UpdatePointersAfterEvacuation() override;
 
+  // Moves live young generation large objects to the old generation and
+  // records their slots.
+  void PromoteNewLargeObjects(RecordMigratedSlotVisitor* record_visitor);
+
   UpdatingItem* CreateToSpaceUpdatingItem(MemoryChunk* chunk, Address start,
                                           Address end) override;
   UpdatingItem* CreateRememberedSetUpdatingItem(
@@ -812,6 +853,12 @@ class MarkCompactCollector final : public MarkCompactCollectorBase {
   // candidates.
   bool compacting_;
 
+  // Live bytes that may still be selected for evacuation in the current
+  // full GC under --compaction-pause-target-ms. The budget is shared by all
+  // compacted spaces.
+  static const size_t kNoEvacuationPauseBudget = SIZE_MAX;
+  size_t evacuation_pause_budget_;
+
   bool black_allocation_;
 
   bool have_code_to_deoptimize_;
@@ -970,6 +1017,11 @@ class MinorMarkCompactCollector final : public MarkCompactCollectorBase {
 
   int CollectNewSpaceArrayBufferTrackerItems(ItemParallelJob* job);
 
+  // Page promotion heuristic for the young generation. Refines
+  // ShouldMovePage() by preferring compaction over page promotion when the
+  // heap optimizes for memory usage.
+  bool ShouldPromotePage(Page* p, intptr_t live_bytes);
+
   int NumberOfParallelMarkingTasks(int pages);
 
   MarkingWorklist* worklist_;
@@ -19,19 +19,60 @@ const int MemoryReducer::kWatchdogDelayMs = 100000;
 const int MemoryReducer::kMaxNumberOfGCs = 3;
 const double MemoryReducer::kCommittedMemoryFactor = 1.1;
 const size_t MemoryReducer::kCommittedMemoryDelta = 10 * MB;
+const double MemoryReducer::kQuietAllocationThroughputInBytesPerMs = 1 * KB;
 
-MemoryReducer::TimerTask::TimerTask(MemoryReducer* memory_reducer)
+const double AllocationRateForecaster::kLevelSmoothing = 0.5;
+const double AllocationRateForecaster::kTrendSmoothing = 0.3;
+
+void AllocationRateForecaster::AddSample(double time_ms, double throughput) {
+  if (!has_samples_) {
+    has_samples_ = true;
+    level_ = throughput;
+    trend_ = 0.0;
+    last_time_ms_ = time_ms;
+    return;
+  }
+  double elapsed_ms = time_ms - last_time_ms_;
+  if (elapsed_ms <= 0) return;
+  double predicted = level_ + trend_ * elapsed_ms;
+  double level =
+      kLevelSmoothing * throughput + (1 - kLevelSmoothing) * predicted;
+  trend_ = kTrendSmoothing * (level - level_) / elapsed_ms +
+           (1 - kTrendSmoothing) * trend_;
+  level_ = level;
+  last_time_ms_ = time_ms;
+}
+
+double AllocationRateForecaster::PredictDelayUntilBelow(double threshold,
+                                                       double now_ms) const {
+  if (!has_samples_) return -1;
+  if (level_ <= threshold) return 0;
+  if (trend_ >= 0) return -1;
+  // The extrapolation starts at the last sample, which may be a while ago.
+  double elapsed_ms = Max(0.0, now_ms - last_time_ms_);
+  return Max(0.0, (threshold - level_) / trend_ - elapsed_ms);
+}
+
+MemoryReducer::TimerTask::TimerTask(MemoryReducer* memory_reducer, int id)
     : CancelableTask(memory_reducer->heap()->isolate()),
-      memory_reducer_(memory_reducer) {}
+      memory_reducer_(memory_reducer),
+      id_(id) {}
 
 
 void MemoryReducer::TimerTask::RunInternal() {
+  if (id_ != memory_reducer_->timer_id_) return;
   Heap* heap = memory_reducer_->heap();
   Event event;
   double time_ms = heap->MonotonicallyIncreasingTimeInMs();
   heap->tracer()->SampleAllocation(time_ms, heap->NewSpaceAllocationCounter(),
                                    heap->OldGenerationAllocationCounter());
   bool low_allocation_rate = heap->HasLowAllocationRate();
+  double quiet_period_delay_ms = -1;
+  if (FLAG_predictive_memory_reducer) {
+    memory_reducer_->SampleAllocationRate();
+    quiet_period_delay_ms = memory_reducer_->PredictQuietPeriodDelayMs();
+    if (quiet_period_delay_ms == 0) low_allocation_rate = true;
+  }
   bool optimize_for_memory = heap->ShouldOptimizeForMemoryUsage();
   if (FLAG_trace_gc_verbose) {
     heap->isolate()->PrintWithTimestamp(
@@ -50,6 +91,7 @@ void MemoryReducer::TimerTask::RunInternal() {
       heap->incremental_marking()->IsStopped() &&
       (heap->incremental_marking()->CanBeActivated() || optimize_for_memory);
   event.committed_memory = heap->CommittedOldGenerationMemory();
+  event.quiet_period_delay_ms = quiet_period_delay_ms;
   memory_reducer_->NotifyTimer(event);
 }
 
@@ -96,6 +138,7 @@ void MemoryReducer::NotifyTimer(const Event& event) {
 
 void MemoryReducer::NotifyMarkCompact(const Event& event) {
   DCHECK_EQ(kMarkCompact, event.type);
+  if (FLAG_predictive_memory_reducer) SampleAllocationRate();
   Action old_action = state_.action;
   state_ = Step(state_, event);
   if (old_action != kWait && state_.action == kWait) {
@@ -128,6 +171,33 @@ bool MemoryReducer::WatchdogGC(const State& state, const Event& event) {
 }
 
 
+double MemoryReducer::WaitDelayMs(const Event& event) {
+  if (!FLAG_predictive_memory_reducer || event.quiet_period_delay_ms < 0) {
+    return kLongDelayMs;
+  }
+  return Min(Max(event.quiet_period_delay_ms,
+                 static_cast<double>(kShortDelayMs)),
+             static_cast<double>(kLongDelayMs));
+}
+
+
+void MemoryReducer::SampleAllocationRate() {
+  // The tracer samples the allocation counters at every GC and timer tick,
+  // so its current throughput covers the recent past.
+  forecaster_.AddSample(
+      heap()->MonotonicallyIncreasingTimeInMs(),
+      heap()->tracer()->CurrentAllocationThroughputInBytesPerMillisecond());
+}
+
+
+double MemoryReducer::PredictQuietPeriodDelayMs() const {
+  if (!FLAG_predictive_memory_reducer) return -1;
+  return forecaster_.PredictDelayUntilBelow(
+      kQuietAllocationThroughputInBytesPerMs,
+      heap_->MonotonicallyIncreasingTimeInMs());
+}
+
+
 // For specification of this function see the comment for MemoryReducer class.
 MemoryReducer::State MemoryReducer::Step(const State& state,
                                          const Event& event) {
@@ -175,7 +245,8 @@ MemoryReducer::State MemoryReducer::Step(const State& state,
               return state;
             }
           } else {
-            return State(kWait, state.started_gcs, event.time_ms + kLongDelayMs,
+            return State(kWait, state.started_gcs,
+                         event.time_ms + WaitDelayMs(event),
                          state.last_gc_time_ms, 0);
           }
         case kMarkCompact:
@@ -206,11 +277,34 @@ void MemoryReducer::ScheduleTimer(double time_ms, double delay_ms) {
   // Leave some room for precision error in task scheduler.
   const double kSlackMs = 100;
   v8::Isolate* isolate = reinterpret_cast<v8::Isolate*>(heap()->isolate());
-  auto timer_task = new MemoryReducer::TimerTask(this);
+  auto timer_task = new MemoryReducer::TimerTask(this, ++timer_id_);
   V8::GetCurrentPlatform()->CallDelayedOnForegroundThread(
       isolate, timer_task, (delay_ms + kSlackMs) / 1000.0);
 }
 
+bool MemoryReducer::StartPendingGC(double time_ms) {
+  if (state_.action != kWait || state_.started_gcs >= kMaxNumberOfGCs) {
+    return false;
+  }
+  if (!FLAG_incremental_marking || !FLAG_memory_reducer ||
+      !heap()->incremental_marking()->IsStopped() ||
+      !heap()->incremental_marking()->CanBeActivated()) {
+    return false;
+  }
+  // Invalidate the pending timer. A new one is scheduled when the started GC
+  // transitions back to the WAIT state.
+  timer_id_++;
+  state_ = State(kRun, state_.started_gcs + 1, 0.0, state_.last_gc_time_ms, 0);
+  if (FLAG_trace_gc_verbose) {
+    heap()->isolate()->PrintWithTimestamp(
+        "Memory reducer: started GC #%d early at %.f ms\n", state_.started_gcs,
+        time_ms);
+  }
+  heap()->StartIdleIncrementalMarking(GarbageCollectionReason::kMemoryReducer,
+                                      kGCCallbackFlagCollectAllExternalMemory);
+  return true;
+}
+
 void MemoryReducer::TearDown() { state_ = State(kDone, 0, 0, 0.0, 0); }
 
 }  // namespace internal
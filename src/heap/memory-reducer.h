@@ -15,6 +15,35 @@ namespace internal {
 
 class Heap;
 
+// Forecasts the mutator allocation throughput using double exponential
+// smoothing (Holt's linear method). Samples may arrive at irregular
+// intervals, so the trend is kept per millisecond.
+class V8_EXPORT_PRIVATE AllocationRateForecaster {
+ public:
+  AllocationRateForecaster()
+      : has_samples_(false), level_(0.0), trend_(0.0), last_time_ms_(0.0) {}
+
+  void AddSample(double time_ms, double throughput);
+
+  // Returns the delay after |now_ms| at which the throughput is predicted
+  // to fall to |threshold|, 0 if it already has, or a negative value if the
+  // throughput is not falling.
+  double PredictDelayUntilBelow(double threshold, double now_ms) const;
+
+  double level() const { return level_; }
+  double trend() const { return trend_; }
+  double last_time_ms() const { return last_time_ms_; }
+
+  static const double kLevelSmoothing;
+  static const double kTrendSmoothing;
+
+ private:
+  bool has_samples_;
+  double level_;
+  double trend_;
+  double last_time_ms_;
+};
+
 
 // The goal of the MemoryReducer class is to detect transition of the mutator
 // from high allocation phase to low allocation phase and to collect potential
@@ -80,6 +109,12 @@ class Heap;
 // now_ms is the current time,
 // t' is t if the current event is not a GC event and is now_ms otherwise,
 // long_delay_ms, short_delay_ms, and watchdog_delay_ms are constants.
+//
+// With --predictive-memory-reducer the allocation throughput is forecast on
+// every timer tick and mark-compact. A forecast quiet period counts as a low
+// allocation rate, and the WAIT timer is re-armed for the predicted start of
+// the quiet period (clamped to [short_delay_ms, long_delay_ms]) instead of
+// always waiting long_delay_ms.
 class V8_EXPORT_PRIVATE MemoryReducer {
  public:
   enum Action { kDone, kWait, kRun };
@@ -108,13 +143,18 @@ class V8_EXPORT_PRIVATE MemoryReducer {
     bool next_gc_likely_to_collect_more;
     bool should_start_incremental_gc;
     bool can_start_incremental_gc;
+    // Predicted delay until the allocation rate drops, or a negative value
+    // if no quiet period is predicted. Only used by timer events with
+    // --predictive-memory-reducer.
+    double quiet_period_delay_ms;
   };
 
   explicit MemoryReducer(Heap* heap)
       : heap_(heap),
         state_(kDone, 0, 0.0, 0.0, 0),
         js_calls_counter_(0),
-        js_calls_sample_time_ms_(0.0) {}
+        js_calls_sample_time_ms_(0.0),
+        timer_id_(0) {}
   // Callbacks.
   void NotifyMarkCompact(const Event& event);
   void NotifyPossibleGarbage(const Event& event);
@@ -124,7 +164,14 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   static State Step(const State& state, const Event& event);
   // Posts a timer task that will call NotifyTimer after the given delay.
   void ScheduleTimer(double time_ms, double delay_ms);
+  // Starts the GC that the WAIT state is waiting for right away instead of
+  // at the next timer event. Used when the embedder reports that the mutator
+  // is quiescent. Returns true if incremental marking was started.
+  bool StartPendingGC(double time_ms);
   void TearDown();
+  // Returns the predicted delay from now until the next quiet period, 0 if
+  // it has started, or a negative value if none is predicted.
+  double PredictQuietPeriodDelayMs() const;
   static const int kLongDelayMs;
   static const int kShortDelayMs;
   static const int kWatchdogDelayMs;
@@ -135,6 +182,9 @@ class V8_EXPORT_PRIVATE MemoryReducer {
   // The committed memory has to increase by at least this amount since the
   // last run in order to trigger a new run after mark-compact.
   static const size_t kCommittedMemoryDelta;
+  // Forecast allocation throughput at or below which the mutator is
+  // considered quiet.
+  static const double kQuietAllocationThroughputInBytesPerMs;
 
   Heap* heap() { return heap_; }
 
@@ -145,23 +195,31 @@ class V8_EXPORT_PRIVATE MemoryReducer {
  private:
   class TimerTask : public v8::internal::CancelableTask {
    public:
-    explicit TimerTask(MemoryReducer* memory_reducer);
+    TimerTask(MemoryReducer* memory_reducer, int id);
 
    private:
     // v8::internal::CancelableTask overrides.
     void RunInternal() override;
     MemoryReducer* memory_reducer_;
+    int id_;
     DISALLOW_COPY_AND_ASSIGN(TimerTask);
   };
 
   void NotifyTimer(const Event& event);
 
   static bool WatchdogGC(const State& state, const Event& event);
+  static double WaitDelayMs(const Event& event);
+
+  void SampleAllocationRate();
 
   Heap* heap_;
   State state_;
+  AllocationRateForecaster forecaster_;
   unsigned int js_calls_counter_;
   double js_calls_sample_time_ms_;
+  // Only the most recently scheduled timer task is live. Older ones become
+  // no-ops, so that starting a pending GC early does not leave a stale timer.
+  int timer_id_;
 
   // Used in cctest.
   friend class HeapTester;
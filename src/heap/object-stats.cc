@@ -32,6 +32,7 @@ void ObjectStats::ClearObjectStats(bool clear_last_time_stats) {
   if (clear_last_time_stats) {
     memset(object_counts_last_time_, 0, sizeof(object_counts_last_time_));
     memset(object_sizes_last_time_, 0, sizeof(object_sizes_last_time_));
+    memset(size_histogram_last_time_, 0, sizeof(size_histogram_last_time_));
   }
 }
 
@@ -158,6 +159,8 @@ void ObjectStats::CheckpointObjectStats() {
   base::LockGuard<base::Mutex> lock_guard(object_stats_mutex.Pointer());
   MemCopy(object_counts_last_time_, object_counts_, sizeof(object_counts_));
   MemCopy(object_sizes_last_time_, object_sizes_, sizeof(object_sizes_));
+  MemCopy(size_histogram_last_time_, size_histogram_,
+          sizeof(size_histogram_));
   ClearObjectStats();
 }
 
@@ -826,8 +829,52 @@ void IterateHeap(Heap* heap, ObjectStatsVisitor* visitor) {
   }
 }
 
+void IterateSampledPages(Heap* heap, ObjectStatsVisitor* visitor, int rate,
+                         int offset) {
+  int page_index = offset;
+  auto sampled = [&page_index, rate]() { return page_index++ % rate == 0; };
+  HeapObject* obj = nullptr;
+  if (sampled()) {
+    std::unique_ptr<ObjectIterator> it(heap->new_space()->GetObjectIterator());
+    while ((obj = it->Next()) != nullptr) {
+      visitor->Visit(obj, obj->Size());
+    }
+  }
+  PagedSpaces spaces(heap, PagedSpaces::SpacesSpecifier::kAllPagedSpaces);
+  for (PagedSpace* space = spaces.next(); space != nullptr;
+       space = spaces.next()) {
+    for (Page* page : *space) {
+      if (!sampled()) continue;
+      HeapObjectIterator it(page);
+      while ((obj = it.Next()) != nullptr) {
+        visitor->Visit(obj, obj->Size());
+      }
+    }
+  }
+  LargeObjectSpace* lo_spaces[] = {heap->lo_space(), heap->new_lo_space()};
+  for (LargeObjectSpace* space : lo_spaces) {
+    if (space == nullptr) continue;
+    for (LargePage* page : *space) {
+      if (!sampled()) continue;
+      obj = page->GetObject();
+      visitor->Visit(obj, obj->Size());
+    }
+  }
+}
+
 }  // namespace
 
+void ObjectStatsCollector::CollectSampled(int rate, int offset) {
+  DCHECK_GT(rate, 0);
+  ObjectStatsCollectorImpl live_collector(heap_, live_);
+  ObjectStatsCollectorImpl dead_collector(heap_, dead_);
+  for (int i = 0; i < ObjectStatsCollectorImpl::kNumberOfPhases; i++) {
+    ObjectStatsVisitor visitor(heap_, &live_collector, &dead_collector,
+                               static_cast<ObjectStatsCollectorImpl::Phase>(i));
+    IterateSampledPages(heap_, &visitor, rate, offset);
+  }
+}
+
 void ObjectStatsCollector::Collect() {
   ObjectStatsCollectorImpl live_collector(heap_, live_);
   ObjectStatsCollectorImpl dead_collector(heap_, dead_);
@@ -76,6 +76,13 @@ class ObjectStats {
  public:
   static const size_t kNoOverAllocation = 0;
 
+  static const int kFirstBucketShift = 5;  // <32
+  static const int kLastBucketShift = 20;  // >=1M
+  static const int kFirstBucket = 1 << kFirstBucketShift;
+  static const int kLastBucket = 1 << kLastBucketShift;
+  static const int kNumberOfBuckets = kLastBucketShift - kFirstBucketShift + 1;
+  static const int kLastValueBucketIndex = kLastBucketShift - kFirstBucketShift;
+
   explicit ObjectStats(Heap* heap) : heap_(heap) { ClearObjectStats(); }
 
   // See description on VIRTUAL_INSTANCE_TYPE_LIST.
@@ -112,17 +119,14 @@ class ObjectStats {
     return object_sizes_last_time_[index];
   }
 
+  size_t size_histogram_last_gc(size_t index, int bucket) {
+    return size_histogram_last_time_[index][bucket];
+  }
+
   Isolate* isolate();
   Heap* heap() { return heap_; }
 
  private:
-  static const int kFirstBucketShift = 5;  // <32
-  static const int kLastBucketShift = 20;  // >=1M
-  static const int kFirstBucket = 1 << kFirstBucketShift;
-  static const int kLastBucket = 1 << kLastBucketShift;
-  static const int kNumberOfBuckets = kLastBucketShift - kFirstBucketShift + 1;
-  static const int kLastValueBucketIndex = kLastBucketShift - kFirstBucketShift;
-
   void PrintKeyAndId(const char* key, int gc_count);
   // The following functions are excluded from inline to reduce the overall
   // binary size of VB. On x64 this save around 80KB.
@@ -143,6 +147,7 @@ class ObjectStats {
   size_t over_allocated_[OBJECT_STATS_COUNT];
   // Detailed histograms by InstanceType.
   size_t size_histogram_[OBJECT_STATS_COUNT][kNumberOfBuckets];
+  size_t size_histogram_last_time_[OBJECT_STATS_COUNT][kNumberOfBuckets];
   size_t over_allocated_histogram_[OBJECT_STATS_COUNT][kNumberOfBuckets];
 };
 
@@ -159,6 +164,12 @@ class ObjectStatsCollector {
   // be present.
   void Collect();
 
+  // Like Collect(), but only visits every |rate|-th page, starting at the
+  // |offset|-th one, and skips the global statistics. The new space counts
+  // as a single page. Scaling the result by |rate| estimates the full
+  // statistics.
+  void CollectSampled(int rate, int offset);
+
  private:
   Heap* const heap_;
   ObjectStats* const live_;
@@ -115,7 +115,7 @@ bool Scavenger::PromoteObject(Map* map, HeapObjectReference** slot,
     }
     HeapObjectReference::Update(slot, target);
     if (!ContainsOnlyData(map->visitor_id())) {
-      promotion_list_.Push(ObjectAndSize(target, object_size));
+      promotion_list_.Push({target, map, object_size});
     }
     promoted_size_ += object_size;
     return true;
@@ -123,8 +123,31 @@ bool Scavenger::PromoteObject(Map* map, HeapObjectReference** slot,
   return false;
 }
 
+bool Scavenger::HandleLargeObject(Map* map, HeapObject* object,
+                                  int object_size) {
+  if (V8_UNLIKELY(FLAG_young_generation_large_objects &&
+                  heap()->new_lo_space()->Contains(object))) {
+    // The object stays where it is and its page is promoted after the
+    // scavenge. A forwarding address pointing to the object itself marks it
+    // as visited; only the task winning the race records it.
+    if (base::AsAtomicPointer::Release_CompareAndSwap(
+            reinterpret_cast<HeapObject**>(object->address()), map,
+            MapWord::FromForwardingAddress(object).ToMap()) == map) {
+      surviving_new_large_objects_.push_back(std::make_pair(object, map));
+      if (!ContainsOnlyData(map->visitor_id())) {
+        promotion_list_.Push({object, map, object_size});
+      }
+      promoted_size_ += object_size;
+    }
+    return true;
+  }
+  return false;
+}
+
 void Scavenger::EvacuateObjectDefault(Map* map, HeapObjectReference** slot,
                                       HeapObject* object, int object_size) {
+  if (HandleLargeObject(map, object, object_size)) return;
+
   SLOW_DCHECK(object_size <= Page::kAllocatableMemory);
   SLOW_DCHECK(object->SizeFromMap(map) == object_size);
 
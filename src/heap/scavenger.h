@@ -5,6 +5,9 @@
 #ifndef V8_HEAP_SCAVENGER_H_
 #define V8_HEAP_SCAVENGER_H_
 
+#include <utility>
+#include <vector>
+
 #include "src/base/platform/condition-variable.h"
 #include "src/heap/local-allocator.h"
 #include "src/heap/objects-visiting.h"
@@ -21,9 +24,20 @@ class Scavenger {
   static const int kCopiedListSegmentSize = 256;
   static const int kPromotionListSegmentSize = 256;
 
+  // Promoted objects keep their map next to them because young generation
+  // large objects are promoted in place and their map word holds a
+  // forwarding address until the scavenge is finished.
+  struct PromotionListEntry {
+    HeapObject* heap_object;
+    Map* map;
+    int size;
+  };
+
   using ObjectAndSize = std::pair<HeapObject*, int>;
   using CopiedList = Worklist<ObjectAndSize, kCopiedListSegmentSize>;
-  using PromotionList = Worklist<ObjectAndSize, kPromotionListSegmentSize>;
+  using PromotionList =
+      Worklist<PromotionListEntry, kPromotionListSegmentSize>;
+  using SurvivingNewLargeObjects = std::vector<std::pair<HeapObject*, Map*>>;
 
   Scavenger(Heap* heap, bool is_logging, CopiedList* copied_list,
             PromotionList* promotion_list, int task_id);
@@ -42,6 +56,12 @@ class Scavenger {
   size_t bytes_copied() const { return copied_size_; }
   size_t bytes_promoted() const { return promoted_size_; }
 
+  // Young generation large objects found live by this scavenger, together
+  // with their original maps.
+  const SurvivingNewLargeObjects& surviving_new_large_objects() const {
+    return surviving_new_large_objects_;
+  }
+
  private:
   // Number of objects to process before interrupting for potentially waking
   // up other tasks.
@@ -73,6 +93,11 @@ class Scavenger {
   V8_INLINE bool PromoteObject(Map* map, HeapObjectReference** slot,
                                HeapObject* object, int object_size);
 
+  // Keeps |object| alive if it resides in the young generation large object
+  // space. Returns false for all other objects.
+  V8_INLINE bool HandleLargeObject(Map* map, HeapObject* object,
+                                   int object_size);
+
   V8_INLINE void EvacuateObject(HeapObjectReference** slot, Map* map,
                                 HeapObject* source);
 
@@ -90,7 +115,8 @@ class Scavenger {
   inline void EvacuateShortcutCandidate(Map* map, HeapObject** slot,
                                         ConsString* object, int object_size);
 
-  void IterateAndScavengePromotedObject(HeapObject* target, int size);
+  void IterateAndScavengePromotedObject(HeapObject* target, Map* map,
+                                        int size);
 
   static inline bool ContainsOnlyData(VisitorId visitor_id);
 
@@ -98,6 +124,7 @@ class Scavenger {
   PromotionList::View promotion_list_;
   CopiedList::View copied_list_;
   Heap::PretenuringFeedbackMap local_pretenuring_feedback_;
+  SurvivingNewLargeObjects surviving_new_large_objects_;
   size_t copied_size_;
   size_t promoted_size_;
   LocalAllocator allocator_;
@@ -431,14 +431,17 @@ void MemoryAllocator::Unmapper::PerformFreeMemoryOnQueuedChunks() {
   // Regular chunks.
   while ((chunk = GetMemoryChunkSafe<kRegular>()) != nullptr) {
     bool pooled = chunk->IsFlagSet(MemoryChunk::POOLED);
+    int numa_node = chunk->numa_node();
     allocator_->PerformFreeMemory(chunk);
-    if (pooled) AddMemoryChunkSafe<kPooled>(chunk);
+    if (pooled) AddPooledMemoryChunkSafe(chunk, numa_node);
   }
   if (mode == MemoryAllocator::Unmapper::FreeMode::kReleasePooled) {
     // The previous loop uncommitted any pages marked as pooled and added them
     // to the pooled list. In case of kReleasePooled we need to free them
     // though.
-    while ((chunk = GetMemoryChunkSafe<kPooled>()) != nullptr) {
+    int numa_node;
+    while ((chunk = GetPooledMemoryChunkSafe(PageAllocator::kNoNumaNode,
+                                             &numa_node)) != nullptr) {
       allocator_->Free<MemoryAllocator::kAlreadyPooled>(chunk);
     }
   }
@@ -512,13 +515,19 @@ Address MemoryAllocator::ReserveAlignedMemory(size_t size, size_t alignment,
 
 Address MemoryAllocator::AllocateAlignedMemory(
     size_t reserve_size, size_t commit_size, size_t alignment,
-    Executability executable, void* hint, VirtualMemory* controller) {
+    Executability executable, void* hint, VirtualMemory* controller,
+    int numa_node) {
   DCHECK(commit_size <= reserve_size);
   VirtualMemory reservation;
   Address base =
       ReserveAlignedMemory(reserve_size, alignment, hint, &reservation);
   if (base == kNullAddress) return kNullAddress;
 
+  if (numa_node != PageAllocator::kNoNumaNode) {
+    // The policy is only a preference, so failing to apply it is harmless.
+    SetNumaPolicy(reservation.address(), reservation.size(), numa_node);
+  }
+
   if (executable == EXECUTABLE) {
     if (!CommitExecutableMemory(&reservation, base, commit_size,
                                 reserve_size)) {
@@ -646,6 +655,7 @@ MemoryChunk* MemoryChunk::Initialize(Heap* heap, Address base, size_t size,
   chunk->allocated_bytes_ = chunk->area_size();
   chunk->wasted_memory_ = 0;
   chunk->young_generation_bitmap_ = nullptr;
+  chunk->numa_node_ = PageAllocator::kNoNumaNode;
   chunk->set_next_chunk(nullptr);
   chunk->set_prev_chunk(nullptr);
   chunk->local_tracker_ = nullptr;
@@ -710,7 +720,7 @@ Page* SemiSpace::InitializePage(MemoryChunk* chunk, Executability executable) {
   heap()->incremental_marking()->SetNewSpacePageFlags(page);
   page->AllocateLocalTracker();
 #ifdef ENABLE_MINOR_MC
-  if (FLAG_minor_mc) {
+  if (heap()->use_minor_mc()) {
     page->AllocateYoungGenerationBitmap();
     heap()
         ->minor_mark_compact_collector()
@@ -778,13 +788,15 @@ Page* Page::ConvertNewToOld(Page* old_page) {
 }
 
 size_t MemoryChunk::CommittedPhysicalMemory() {
-  if (!base::OS::HasLazyCommits() || owner()->identity() == LO_SPACE)
+  if (!base::OS::HasLazyCommits() || owner()->identity() == LO_SPACE ||
+      owner()->identity() == NEW_LO_SPACE)
     return size();
   return high_water_mark_.Value();
 }
 
 bool MemoryChunk::IsPagedSpace() const {
-  return owner()->identity() != LO_SPACE;
+  return owner()->identity() != LO_SPACE &&
+         owner()->identity() != NEW_LO_SPACE;
 }
 
 void MemoryChunk::InsertAfter(MemoryChunk* other) {
@@ -820,6 +832,7 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
   Address area_end = kNullAddress;
   void* address_hint =
       AlignedAddress(heap->GetRandomMmapAddr(), MemoryChunk::kAlignment);
+  int numa_node = PreferredNumaNode();
 
   //
   // MemoryChunk layout:
@@ -871,13 +884,14 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
           code_range()->AllocateRawMemory(chunk_size, commit_size, &chunk_size);
       DCHECK(IsAligned(base, MemoryChunk::kAlignment));
       if (base == kNullAddress) return nullptr;
+      numa_node = PageAllocator::kNoNumaNode;
       size_.Increment(chunk_size);
       // Update executable memory size.
       size_executable_.Increment(chunk_size);
     } else {
       base = AllocateAlignedMemory(chunk_size, commit_size,
                                    MemoryChunk::kAlignment, executable,
-                                   address_hint, &reservation);
+                                   address_hint, &reservation, numa_node);
       if (base == kNullAddress) return nullptr;
       // Update executable memory size.
       size_executable_.Increment(reservation.size());
@@ -898,7 +912,8 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
                   GetCommitPageSize());
     base =
         AllocateAlignedMemory(chunk_size, commit_size, MemoryChunk::kAlignment,
-                              executable, address_hint, &reservation);
+                              executable, address_hint, &reservation,
+                              numa_node);
 
     if (base == kNullAddress) return nullptr;
 
@@ -937,6 +952,7 @@ MemoryChunk* MemoryAllocator::AllocateChunk(size_t reserve_area_size,
   MemoryChunk* chunk =
       MemoryChunk::Initialize(heap, base, chunk_size, area_start, area_end,
                               executable, owner, &reservation);
+  chunk->numa_node_ = numa_node;
 
   if (chunk->executable()) RegisterExecutableMemoryChunk(chunk);
   return chunk;
@@ -1174,22 +1190,37 @@ LargePage* MemoryAllocator::AllocateLargePage(size_t size,
 
 template <typename SpaceType>
 MemoryChunk* MemoryAllocator::AllocatePagePooled(SpaceType* owner) {
-  MemoryChunk* chunk = unmapper()->TryGetPooledMemoryChunkSafe();
+  const int numa_node = PreferredNumaNode();
+  int chunk_numa_node = PageAllocator::kNoNumaNode;
+  MemoryChunk* chunk =
+      unmapper()->TryGetPooledMemoryChunkSafe(numa_node, &chunk_numa_node);
   if (chunk == nullptr) return nullptr;
   const int size = MemoryChunk::kPageSize;
   const Address start = reinterpret_cast<Address>(chunk);
   const Address area_start = start + MemoryChunk::kObjectStartOffset;
   const Address area_end = start + size;
+  if (numa_node != PageAllocator::kNoNumaNode &&
+      numa_node != chunk_numa_node) {
+    // Rebind a chunk of another node before its memory is faulted in again.
+    SetNumaPolicy(start, size, numa_node);
+    chunk_numa_node = numa_node;
+  }
   if (!CommitBlock(start, size, NOT_EXECUTABLE)) {
     return nullptr;
   }
   VirtualMemory reservation(start, size);
   MemoryChunk::Initialize(isolate_->heap(), start, size, area_start, area_end,
                           NOT_EXECUTABLE, owner, &reservation);
+  chunk->numa_node_ = chunk_numa_node;
   size_.Increment(size);
   return chunk;
 }
 
+int MemoryAllocator::PreferredNumaNode() {
+  if (!FLAG_numa_aware_page_allocation) return PageAllocator::kNoNumaNode;
+  return GetCurrentNumaNode();
+}
+
 bool MemoryAllocator::CommitBlock(Address start, size_t size,
                                   Executability executable) {
   if (!CommitMemory(start, size, executable)) return false;
@@ -3277,19 +3308,32 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
     return AllocationResult::Retry(identity());
   }
 
+  LargePage* page = AllocateLargePage(object_size, executable);
+  if (page == nullptr) return AllocationResult::Retry(identity());
+  HeapObject* object = page->GetObject();
+
+  heap()->StartIncrementalMarkingIfAllocationLimitIsReached(
+      heap()->GCFlagsForIncrementalMarking(),
+      kGCCallbackScheduleIdleGarbageCollection);
+  if (heap()->incremental_marking()->black_allocation()) {
+    heap()->incremental_marking()->marking_state()->WhiteToBlack(object);
+  }
+  AllocationStep(object_size, object->address(), object_size);
+  DCHECK_IMPLIES(
+      heap()->incremental_marking()->black_allocation(),
+      heap()->incremental_marking()->marking_state()->IsBlack(object));
+  return object;
+}
+
+
+LargePage* LargeObjectSpace::AllocateLargePage(int object_size,
+                                               Executability executable) {
   LargePage* page = heap()->memory_allocator()->AllocateLargePage(
       object_size, this, executable);
-  if (page == nullptr) return AllocationResult::Retry(identity());
+  if (page == nullptr) return nullptr;
   DCHECK_GE(page->area_size(), static_cast<size_t>(object_size));
 
-  size_ += static_cast<int>(page->size());
-  AccountCommitted(page->size());
-  objects_size_ += object_size;
-  page_count_++;
-  page->set_next_page(first_page_);
-  first_page_ = page;
-
-  InsertChunkMapEntries(page);
+  AddPage(page, object_size);
 
   HeapObject* object = page->GetObject();
 
@@ -3301,22 +3345,11 @@ AllocationResult LargeObjectSpace::AllocateRaw(int object_size,
     reinterpret_cast<Object**>(object->address())[1] = Smi::kZero;
   }
 
-  heap()->StartIncrementalMarkingIfAllocationLimitIsReached(
-      heap()->GCFlagsForIncrementalMarking(),
-      kGCCallbackScheduleIdleGarbageCollection);
   heap()->CreateFillerObjectAt(object->address(), object_size,
                                ClearRecordedSlots::kNo);
-  if (heap()->incremental_marking()->black_allocation()) {
-    heap()->incremental_marking()->marking_state()->WhiteToBlack(object);
-  }
-  AllocationStep(object_size, object->address(), object_size);
-  DCHECK_IMPLIES(
-      heap()->incremental_marking()->black_allocation(),
-      heap()->incremental_marking()->marking_state()->IsBlack(object));
-  return object;
+  return page;
 }
 
-
 size_t LargeObjectSpace::CommittedPhysicalMemory() {
   // On a platform that provides lazy committing of memory, we over-account
   // the actually committed memory. There is no easy way right now to support
@@ -3368,6 +3401,48 @@ void LargeObjectSpace::ClearMarkingStateOfLiveObjects() {
   }
 }
 
+void LargeObjectSpace::PromoteNewLargeObject(LargePage* page) {
+  DCHECK_EQ(page->owner()->identity(), NEW_LO_SPACE);
+  DCHECK(page->InNewSpace());
+  size_t object_size = static_cast<size_t>(page->GetObject()->Size());
+  static_cast<LargeObjectSpace*>(page->owner())->RemovePage(page, object_size);
+  AddPage(page, object_size);
+  page->ClearFlag(MemoryChunk::IN_FROM_SPACE);
+  page->ClearFlag(MemoryChunk::IN_TO_SPACE);
+  page->set_owner(this);
+  heap()->incremental_marking()->SetOldSpacePageFlags(page);
+}
+
+void LargeObjectSpace::AddPage(LargePage* page, size_t object_size) {
+  size_ += static_cast<int>(page->size());
+  AccountCommitted(page->size());
+  objects_size_ += object_size;
+  page_count_++;
+  page->set_next_page(first_page_);
+  first_page_ = page;
+
+  InsertChunkMapEntries(page);
+}
+
+void LargeObjectSpace::RemovePage(LargePage* page, size_t object_size) {
+  size_ -= static_cast<int>(page->size());
+  AccountUncommitted(page->size());
+  objects_size_ -= object_size;
+  page_count_--;
+
+  if (first_page_ == page) {
+    first_page_ = page->next_page();
+  } else {
+    LargePage* previous = first_page_;
+    while (previous->next_page() != page) previous = previous->next_page();
+    previous->set_next_page(page->next_page());
+  }
+  page->set_next_page(nullptr);
+
+  base::LockGuard<base::Mutex> guard(&chunk_map_mutex_);
+  RemoveChunkMapEntries(page);
+}
+
 void LargeObjectSpace::InsertChunkMapEntries(LargePage* page) {
   // There may be concurrent access on the chunk map. We have to take the lock
   // here.
@@ -3457,6 +3532,68 @@ std::unique_ptr<ObjectIterator> LargeObjectSpace::GetObjectIterator() {
   return std::unique_ptr<ObjectIterator>(new LargeObjectIterator(this));
 }
 
+// -----------------------------------------------------------------------------
+// NewLargeObjectSpace
+
+NewLargeObjectSpace::NewLargeObjectSpace(Heap* heap)
+    : LargeObjectSpace(heap, NEW_LO_SPACE) {}
+
+AllocationResult NewLargeObjectSpace::AllocateRaw(int object_size) {
+  // Do not allocate more objects if promoting the existing objects would
+  // exceed the old generation capacity.
+  if (!heap()->CanExpandOldGeneration(SizeOfObjects())) {
+    return AllocationResult::Retry(identity());
+  }
+
+  // Allocation for the first object must succeed independent of the capacity.
+  if (SizeOfObjects() > 0 && static_cast<size_t>(object_size) > Available()) {
+    return AllocationResult::Retry(identity());
+  }
+
+  LargePage* page = AllocateLargePage(object_size, NOT_EXECUTABLE);
+  if (page == nullptr) return AllocationResult::Retry(identity());
+
+  page->SetFlag(MemoryChunk::IN_TO_SPACE);
+  heap()->incremental_marking()->SetNewSpacePageFlags(page);
+  page->InitializationMemoryFence();
+
+  HeapObject* object = page->GetObject();
+  AllocationStep(object_size, object->address(), object_size);
+  return object;
+}
+
+size_t NewLargeObjectSpace::Available() {
+  size_t capacity = heap()->new_space()->Capacity();
+  return capacity > SizeOfObjects() ? capacity - SizeOfObjects() : 0;
+}
+
+void NewLargeObjectSpace::Flip() {
+  for (LargePage* chunk = first_page_; chunk != nullptr;
+       chunk = chunk->next_page()) {
+    chunk->SetFlag(MemoryChunk::IN_FROM_SPACE);
+    chunk->ClearFlag(MemoryChunk::IN_TO_SPACE);
+  }
+}
+
+void NewLargeObjectSpace::FreeAllObjects() {
+  LargePage* current = first_page_;
+  while (current != nullptr) {
+    LargePage* next = current->next_page();
+    if (FLAG_concurrent_marking) {
+      // Ensure that the concurrent marker does not track a page that is
+      // going to be unmapped.
+      heap()->concurrent_marking()->ClearLiveness(current);
+    }
+    // The map of a dead object may already be gone, so the object size is
+    // not accounted per page; the counter is reset below.
+    RemovePage(current, 0);
+    heap()->memory_allocator()->Free<MemoryAllocator::kPreFreeAndQueue>(
+        current);
+    current = next;
+  }
+  objects_size_ = 0;
+}
+
 #ifdef VERIFY_HEAP
 // We do not assume that the large object iterator works, because it depends
 // on the invariants we are checking during verification.
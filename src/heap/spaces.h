@@ -377,7 +377,8 @@ class MemoryChunk {
       // FreeListCategory categories_[kNumberOfCategories]
       + kPointerSize   // LocalArrayBufferTracker* local_tracker_
       + kIntptrSize    // intptr_t young_generation_live_byte_count_
-      + kPointerSize;  // Bitmap* young_generation_bitmap_
+      + kPointerSize   // Bitmap* young_generation_bitmap_
+      + kIntptrSize;   // intptr_t numa_node_
 
   // We add some more space to the computed header size to amount for missing
   // alignment requirements in our computation.
@@ -458,6 +459,10 @@ class MemoryChunk {
   size_t size() const { return size_; }
   void set_size(size_t size) { size_ = size; }
 
+  // NUMA node the memory of this chunk was requested from, or
+  // PageAllocator::kNoNumaNode.
+  int numa_node() const { return static_cast<int>(numa_node_); }
+
   inline Heap* heap() const { return heap_; }
 
   Heap* synchronized_heap();
@@ -714,6 +719,8 @@ class MemoryChunk {
   intptr_t young_generation_live_byte_count_;
   Bitmap* young_generation_bitmap_;
 
+  intptr_t numa_node_;
+
  private:
   void InitializeReservedMemory() { reservation_.Reset(); }
 
@@ -1195,16 +1202,20 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
       }
     }
 
-    MemoryChunk* TryGetPooledMemoryChunkSafe() {
+    // Returns a chunk of kPageSize whose memory is not committed, and the NUMA
+    // node it was allocated for via |chunk_numa_node|.
+    MemoryChunk* TryGetPooledMemoryChunkSafe(int numa_node,
+                                             int* chunk_numa_node) {
       // Procedure:
       // (1) Try to get a chunk that was declared as pooled and already has
-      // been uncommitted.
+      // been uncommitted, preferably one of |numa_node|.
       // (2) Try to steal any memory chunk of kPageSize that would've been
       // unmapped.
-      MemoryChunk* chunk = GetMemoryChunkSafe<kPooled>();
+      MemoryChunk* chunk = GetPooledMemoryChunkSafe(numa_node, chunk_numa_node);
       if (chunk == nullptr) {
         chunk = GetMemoryChunkSafe<kRegular>();
         if (chunk != nullptr) {
+          *chunk_numa_node = chunk->numa_node();
           // For stolen chunks we need to manually free any allocated memory.
           chunk->ReleaseAllocatedMemory();
         }
@@ -1244,6 +1255,7 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
 
     template <ChunkQueueType type>
     MemoryChunk* GetMemoryChunkSafe() {
+      STATIC_ASSERT(type != kPooled);
       base::LockGuard<base::Mutex> guard(&mutex_);
       if (chunks_[type].empty()) return nullptr;
       MemoryChunk* chunk = chunks_[type].back();
@@ -1251,6 +1263,34 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
       return chunk;
     }
 
+    // Pooled chunks are uncommitted, so their NUMA node is kept on the side.
+    void AddPooledMemoryChunkSafe(MemoryChunk* chunk, int numa_node) {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      chunks_[kPooled].push_back(chunk);
+      pooled_numa_nodes_.push_back(numa_node);
+    }
+
+    // Returns the most recently pooled chunk of |numa_node|, or the most
+    // recently pooled chunk of any node if there is none.
+    MemoryChunk* GetPooledMemoryChunkSafe(int numa_node,
+                                          int* chunk_numa_node) {
+      base::LockGuard<base::Mutex> guard(&mutex_);
+      std::vector<MemoryChunk*>& pool = chunks_[kPooled];
+      if (pool.empty()) return nullptr;
+      size_t index = pool.size() - 1;
+      for (size_t i = pool.size(); i > 0; i--) {
+        if (pooled_numa_nodes_[i - 1] == numa_node) {
+          index = i - 1;
+          break;
+        }
+      }
+      MemoryChunk* chunk = pool[index];
+      *chunk_numa_node = pooled_numa_nodes_[index];
+      pool.erase(pool.begin() + index);
+      pooled_numa_nodes_.erase(pooled_numa_nodes_.begin() + index);
+      return chunk;
+    }
+
     bool MakeRoomForNewTasks();
 
     template <FreeMode mode>
@@ -1262,6 +1302,8 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
     MemoryAllocator* const allocator_;
     base::Mutex mutex_;
     std::vector<MemoryChunk*> chunks_[kNumberOfChunkQueues];
+    // NUMA nodes of the chunks in chunks_[kPooled], in the same order.
+    std::vector<int> pooled_numa_nodes_;
     CancelableTaskManager::Id task_ids_[kMaxUnmapperTasks];
     base::Semaphore pending_unmapping_tasks_semaphore_;
     intptr_t pending_unmapping_tasks_;
@@ -1355,9 +1397,13 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
 
   Address ReserveAlignedMemory(size_t requested, size_t alignment, void* hint,
                                VirtualMemory* controller);
+  // Reserves and commits memory. If |numa_node| is not
+  // PageAllocator::kNoNumaNode the reservation is bound to that node before
+  // any of its pages are touched.
   Address AllocateAlignedMemory(size_t reserve_size, size_t commit_size,
                                 size_t alignment, Executability executable,
-                                void* hint, VirtualMemory* controller);
+                                void* hint, VirtualMemory* controller,
+                                int numa_node);
 
   bool CommitMemory(Address addr, size_t size, Executability executable);
 
@@ -1409,6 +1455,10 @@ class V8_EXPORT_PRIVATE MemoryAllocator {
   // FreeMemory can be called concurrently when PreFree was executed before.
   void PerformFreeMemory(MemoryChunk* chunk);
 
+  // Returns the NUMA node that memory requested by the calling thread should
+  // come from, or PageAllocator::kNoNumaNode if no NUMA policy is applied.
+  static int PreferredNumaNode();
+
   // See AllocatePage for public interface. Note that currently we only support
   // pools for NOT_EXECUTABLE pages of size MemoryChunk::kPageSize.
   template <typename SpaceType>
@@ -2957,6 +3007,10 @@ class LargeObjectSpace : public Space {
   // Frees unmarked objects.
   void FreeUnmarkedObjects();
 
+  // Moves a surviving page of the young generation large object space into
+  // this space. The object on the page is not moved.
+  void PromoteNewLargeObject(LargePage* page);
+
   void InsertChunkMapEntries(LargePage* page);
   void RemoveChunkMapEntries(LargePage* page);
   void RemoveChunkMapEntries(LargePage* page, Address free_start);
@@ -2990,12 +3044,21 @@ class LargeObjectSpace : public Space {
   void Print() override;
 #endif
 
- private:
+ protected:
+  // Allocates a page for a single object of |object_size| bytes and links it
+  // into this space. Returns nullptr if the memory allocator fails.
+  LargePage* AllocateLargePage(int object_size, Executability executable);
+
+  void AddPage(LargePage* page, size_t object_size);
+  void RemovePage(LargePage* page, size_t object_size);
+
   // The head of the linked list of large object chunks.
   LargePage* first_page_;
   size_t size_;            // allocated bytes
   int page_count_;         // number of chunks
   size_t objects_size_;    // size of objects
+
+ private:
   // The chunk_map_mutex_ has to be used when the chunk map is accessed
   // concurrently.
   base::Mutex chunk_map_mutex_;
@@ -3006,6 +3069,30 @@ class LargeObjectSpace : public Space {
 };
 
 
+// -----------------------------------------------------------------------------
+// Large objects allocated in the young generation. Pages of this space are
+// flagged as new space pages. A scavenge never copies these objects: a
+// surviving object is promoted by moving its page to the old generation large
+// object space and pages of dead objects are released as a whole. The space is
+// empty after every garbage collection.
+
+class NewLargeObjectSpace : public LargeObjectSpace {
+ public:
+  explicit NewLargeObjectSpace(Heap* heap);
+
+  V8_WARN_UNUSED_RESULT AllocationResult AllocateRaw(int object_size);
+
+  // Available bytes for objects in this space. The space is bounded by the
+  // capacity of the semi space.
+  size_t Available() override;
+
+  // Moves all pages to from space at the start of a scavenge.
+  void Flip();
+
+  // Releases all pages that were not promoted.
+  void FreeAllObjects();
+};
+
 class LargeObjectIterator : public ObjectIterator {
  public:
   explicit LargeObjectIterator(LargeObjectSpace* space);
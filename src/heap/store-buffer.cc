@@ -25,6 +25,7 @@ StoreBuffer::StoreBuffer(Heap* heap)
     lazy_top_[i] = nullptr;
   }
   task_running_ = false;
+  compaction_task_running_ = false;
   insertion_callback = &InsertDuringRuntime;
   deletion_callback = &DeleteDuringRuntime;
 }
@@ -67,6 +68,11 @@ void StoreBuffer::SetUp() {
 
 
 void StoreBuffer::TearDown() {
+  {
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    chunks_to_compact_.clear();
+  }
+  chunks_added_for_compaction_.clear();
   if (virtual_memory_.IsReserved()) virtual_memory_.Free();
   top_ = nullptr;
   for (int i = 0; i < kStoreBuffers; i++) {
@@ -141,6 +147,7 @@ void StoreBuffer::MoveAllEntriesToRememberedSet() {
   lazy_top_[current_] = top_;
   MoveEntriesToRememberedSet(current_);
   top_ = start_[current_];
+  chunks_to_compact_.clear();
 }
 
 void StoreBuffer::ConcurrentlyProcessStoreBuffer() {
@@ -150,5 +157,40 @@ void StoreBuffer::ConcurrentlyProcessStoreBuffer() {
   task_running_ = false;
 }
 
+void StoreBuffer::AddChunksForRememberedSetCompaction(
+    std::vector<MemoryChunk*> chunks) {
+  DCHECK_EQ(IN_GC, mode_);
+  chunks_added_for_compaction_.insert(chunks_added_for_compaction_.end(),
+                                      chunks.begin(), chunks.end());
+}
+
+void StoreBuffer::StartRememberedSetCompaction() {
+  DCHECK_EQ(NOT_IN_GC, mode_);
+  if (chunks_added_for_compaction_.empty()) return;
+  base::LockGuard<base::Mutex> guard(&mutex_);
+  chunks_to_compact_.swap(chunks_added_for_compaction_);
+  chunks_added_for_compaction_.clear();
+  if (!compaction_task_running_ && !heap_->IsTearingDown()) {
+    compaction_task_running_ = true;
+    V8::GetCurrentPlatform()->CallOnWorkerThread(
+        base::make_unique<CompactionTask>(heap_->isolate(), this));
+  }
+}
+
+void StoreBuffer::ConcurrentlyCompactRememberedSets() {
+  while (true) {
+    // The lock is released between chunks to keep the main thread responsive
+    // when it needs to flip the store buffers.
+    base::LockGuard<base::Mutex> guard(&mutex_);
+    if (chunks_to_compact_.empty()) {
+      compaction_task_running_ = false;
+      return;
+    }
+    MemoryChunk* chunk = chunks_to_compact_.back();
+    chunks_to_compact_.pop_back();
+    RememberedSet<OLD_TO_NEW>::FreeEmptyBuckets(chunk);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -5,6 +5,8 @@
 #ifndef V8_HEAP_STORE_BUFFER_H_
 #define V8_HEAP_STORE_BUFFER_H_
 
+#include <vector>
+
 #include "src/allocation.h"
 #include "src/base/logging.h"
 #include "src/base/platform/platform.h"
@@ -46,9 +48,20 @@ class StoreBuffer {
   void MoveEntriesToRememberedSet(int index);
 
   // This method ensures that all used store buffer entries are transferred to
-  // the remembered set.
+  // the remembered set. Pending remembered set compaction work is dropped, so
+  // that the caller may access the remembered set afterwards.
   void MoveAllEntriesToRememberedSet();
 
+  // Registers swept chunks whose empty old-to-new buckets should be freed
+  // after the current GC. Must be called during GC.
+  void AddChunksForRememberedSetCompaction(std::vector<MemoryChunk*> chunks);
+
+  // Frees the empty buckets of the chunks registered during the last GC on a
+  // background thread. The task holds the store buffer lock while it touches
+  // a remembered set, so it never races with runtime insertions and
+  // deletions, which all go through the store buffer.
+  void StartRememberedSetCompaction();
+
   inline bool IsDeletionAddress(Address address) const {
     return address & kDeletionTag;
   }
@@ -182,10 +195,31 @@ class StoreBuffer {
     DISALLOW_COPY_AND_ASSIGN(Task);
   };
 
+  class CompactionTask : public CancelableTask {
+   public:
+    CompactionTask(Isolate* isolate, StoreBuffer* store_buffer)
+        : CancelableTask(isolate),
+          store_buffer_(store_buffer),
+          tracer_(isolate->heap()->tracer()) {}
+    virtual ~CompactionTask() {}
+
+   private:
+    void RunInternal() override {
+      TRACE_BACKGROUND_GC(tracer_,
+                          GCTracer::BackgroundScope::BACKGROUND_STORE_BUFFER);
+      store_buffer_->ConcurrentlyCompactRememberedSets();
+    }
+    StoreBuffer* store_buffer_;
+    GCTracer* tracer_;
+    DISALLOW_COPY_AND_ASSIGN(CompactionTask);
+  };
+
   StoreBufferMode mode() const { return mode_; }
 
   void FlipStoreBuffers();
 
+  void ConcurrentlyCompactRememberedSets();
+
   Heap* heap_;
 
   Address* top_;
@@ -204,6 +238,13 @@ class StoreBuffer {
   // We only want to have at most one concurrent processing tas running.
   bool task_running_;
 
+  // Chunks registered during GC. Only accessed by the main thread.
+  std::vector<MemoryChunk*> chunks_added_for_compaction_;
+
+  // Chunks waiting for the compaction task. Guarded by mutex_.
+  std::vector<MemoryChunk*> chunks_to_compact_;
+  bool compaction_task_running_;
+
   // Points to the current buffer in use.
   int current_;
 
@@ -88,8 +88,12 @@ class Sweeper::SweeperTask final : public CancelableTask {
       const AllocationSpace space_id = static_cast<AllocationSpace>(
           FIRST_GROWABLE_PAGED_SPACE +
           ((i + offset) % kNumberOfSweepingSpaces));
-      // Do not sweep code space concurrently.
-      if (space_id == CODE_SPACE) continue;
+      // Code space is swept incrementally on the main thread unless
+      // concurrent code space sweeping is enabled.
+      if (space_id == CODE_SPACE &&
+          !sweeper_->ShouldSweepCodeSpaceConcurrently()) {
+        continue;
+      }
       DCHECK(IsValidSweepingSpace(space_id));
       sweeper_->SweepSpaceFromTask(space_id);
     }
@@ -164,10 +168,18 @@ void Sweeper::StartSweeperTasks() {
       task_ids_[num_tasks_++] = task->id();
       V8::GetCurrentPlatform()->CallOnWorkerThread(std::move(task));
     });
-    ScheduleIncrementalSweepingTask();
+    if (!ShouldSweepCodeSpaceConcurrently()) ScheduleIncrementalSweepingTask();
   }
 }
 
+bool Sweeper::ShouldSweepCodeSpaceConcurrently() const {
+  // With write protection, the CodePageMemoryModificationScope in
+  // ParallelSweepPage takes the execute permission away from a page that the
+  // main thread may be running code from.
+  return FLAG_concurrent_code_space_sweeping &&
+         !heap_->write_protect_code_memory();
+}
+
 void Sweeper::SweepOrWaitUntilSweepingCompleted(Page* page) {
   if (!page->SweepingDone()) {
     ParallelSweepPage(page, page->owner()->identity());
@@ -253,9 +265,9 @@ int Sweeper::RawSweep(Page* p, FreeListRebuildingMode free_list_mode,
   Address free_start = p->area_start();
   DCHECK_EQ(0, free_start % (32 * kPointerSize));
 
-  // If we use the skip list for code space pages, we have to lock the skip
-  // list because it could be accessed concurrently by the runtime or the
-  // deoptimizer.
+  // The skip list of a code page is only used on swept pages, see
+  // Heap::GcSafeFindCodeForInnerPointer, so it can be rebuilt without locking
+  // even when sweeping concurrently.
   const bool rebuild_skip_list =
       space->identity() == CODE_SPACE && p->skip_list() != nullptr;
   SkipList* skip_list = p->skip_list();
@@ -418,7 +430,9 @@ int Sweeper::ParallelSweepPage(Page* page, AllocationSpace identity) {
     if (page->SweepingDone()) return 0;
 
     // If the page is a code page, the CodePageMemoryModificationScope changes
-    // the page protection mode from rx -> rw while sweeping.
+    // the page protection mode from rx -> rw while sweeping. Sweeper tasks
+    // therefore only sweep code pages when code memory is not write
+    // protected, see ShouldSweepCodeSpaceConcurrently.
     CodePageMemoryModificationScope code_page_scope(page);
 
     DCHECK_EQ(Page::kSweepingPending,
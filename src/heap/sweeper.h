@@ -100,6 +100,10 @@ class Sweeper {
 
   void ScheduleIncrementalSweepingTask();
 
+  // Whether the sweeper tasks also sweep code space. Requires code pages to
+  // stay executable while they are swept.
+  bool ShouldSweepCodeSpaceConcurrently() const;
+
   int RawSweep(Page* p, FreeListRebuildingMode free_list_mode,
                FreeSpaceTreatmentMode free_space_mode);
 
@@ -40,6 +40,7 @@
 #include "src/field-type.h"
 #include "src/frames-inl.h"
 #include "src/globals.h"
+#include "src/heap/array-buffer-pool.h"
 #include "src/ic/ic.h"
 #include "src/identity-map.h"
 #include "src/interpreter/bytecode-array-iterator.h"
@@ -19212,6 +19213,11 @@ void JSArrayBuffer::FreeBackingStore(Isolate* isolate, Allocation allocation) {
       CHECK(FreePages(allocation.allocation_base, allocation.length));
     }
   } else {
+    ArrayBufferPool* pool = isolate->heap()->array_buffer_pool();
+    if (pool != nullptr && !allocation.is_wasm_memory &&
+        pool->Add(allocation.allocation_base, allocation.length)) {
+      return;
+    }
     isolate->array_buffer_allocator()->Free(allocation.allocation_base,
                                             allocation.length);
   }
@@ -19271,11 +19277,16 @@ bool JSArrayBuffer::SetupAllocatingData(Handle<JSArrayBuffer> array_buffer,
     if (shared == SharedFlag::kShared)
       isolate->counters()->shared_array_allocations()->AddSample(
           ConvertToMb(allocated_length));
-    if (initialize) {
-      data = isolate->array_buffer_allocator()->Allocate(allocated_length);
-    } else {
-      data = isolate->array_buffer_allocator()->AllocateUninitialized(
-          allocated_length);
+    ArrayBufferPool* pool = isolate->heap()->array_buffer_pool();
+    data = pool != nullptr ? pool->Allocate(allocated_length, initialize)
+                           : nullptr;
+    if (data == nullptr) {
+      if (initialize) {
+        data = isolate->array_buffer_allocator()->Allocate(allocated_length);
+      } else {
+        data = isolate->array_buffer_allocator()->AllocateUninitialized(
+            allocated_length);
+      }
     }
     if (data == nullptr) {
       isolate->counters()->array_buffer_new_size_failures()->AddSample(
@@ -120,9 +120,10 @@ void HeapProfiler::StopSamplingHeapProfiler() {
 }
 
 
-v8::AllocationProfile* HeapProfiler::GetAllocationProfile() {
+v8::AllocationProfile* HeapProfiler::GetAllocationProfile(
+    unsigned int min_gcs_survived) {
   if (sampling_heap_profiler_.get()) {
-    return sampling_heap_profiler_->GetAllocationProfile();
+    return sampling_heap_profiler_->GetAllocationProfile(min_gcs_survived);
   } else {
     return nullptr;
   }
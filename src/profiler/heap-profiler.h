@@ -37,7 +37,7 @@ class HeapProfiler : public HeapObjectAllocationTracker {
                                  v8::HeapProfiler::SamplingFlags);
   void StopSamplingHeapProfiler();
   bool is_sampling_allocations() { return !!sampling_heap_profiler_; }
-  AllocationProfile* GetAllocationProfile();
+  AllocationProfile* GetAllocationProfile(unsigned int min_gcs_survived);
 
   void StartHeapObjectsTracking(bool track_allocations);
   void StopHeapObjectsTracking();
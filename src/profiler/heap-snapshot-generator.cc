@@ -592,7 +592,8 @@ V8HeapExplorer::V8HeapExplorer(HeapSnapshot* snapshot,
       heap_object_map_(snapshot_->profiler()->heap_object_map()),
       progress_(progress),
       filler_(nullptr),
-      global_object_name_resolver_(resolver) {}
+      global_object_name_resolver_(resolver),
+      reachable_objects_collected_(false) {}
 
 V8HeapExplorer::~V8HeapExplorer() {
 }
@@ -779,13 +780,15 @@ const char* V8HeapExplorer::GetSystemEntryName(HeapObject* object) {
 }
 
 
-int V8HeapExplorer::EstimateObjectsCount(HeapIterator* iterator) {
-  int objects_count = 0;
-  for (HeapObject* obj = iterator->next(); obj != nullptr;
-       obj = iterator->next()) {
-    objects_count++;
+int V8HeapExplorer::EstimateObjectsCount() {
+  DCHECK(!reachable_objects_collected_);
+  HeapIterator iterator(heap_, HeapIterator::kFilterUnreachable);
+  for (HeapObject* obj = iterator.next(); obj != nullptr;
+       obj = iterator.next()) {
+    reachable_objects_.push_back(obj);
   }
-  return objects_count;
+  reachable_objects_collected_ = true;
+  return static_cast<int>(reachable_objects_.size());
 }
 
 
@@ -1575,6 +1578,9 @@ class RootsReferencesExtractor : public RootVisitor {
 
 bool V8HeapExplorer::IterateAndExtractReferences(
     SnapshotFiller* filler) {
+  // The collected objects must not move while they are visited.
+  DisallowHeapAllocation no_allocation;
+  if (!reachable_objects_collected_) EstimateObjectsCount();
   filler_ = filler;
 
   // Create references to the synthetic roots.
@@ -1598,6 +1604,9 @@ bool V8HeapExplorer::IterateAndExtractReferences(
       IterateAndExtractSinglePass<&V8HeapExplorer::ExtractReferencesPass1>() ||
       IterateAndExtractSinglePass<&V8HeapExplorer::ExtractReferencesPass2>();
 
+  std::vector<HeapObject*>().swap(reachable_objects_);
+  reachable_objects_collected_ = false;
+
   if (interrupted) {
     filler_ = nullptr;
     return false;
@@ -1611,13 +1620,7 @@ bool V8HeapExplorer::IterateAndExtractReferences(
 template<V8HeapExplorer::ExtractReferencesMethod extractor>
 bool V8HeapExplorer::IterateAndExtractSinglePass() {
   // Now iterate the whole heap.
-  bool interrupted = false;
-  HeapIterator iterator(heap_, HeapIterator::kFilterUnreachable);
-  // Heap iteration with filtering must be finished in any case.
-  for (HeapObject *obj = iterator.next(); obj != nullptr;
-       obj = iterator.next(), progress_->ProgressStep()) {
-    if (interrupted) continue;
-
+  for (HeapObject* obj : reachable_objects_) {
     size_t max_pointer = obj->Size() / kPointerSize;
     if (max_pointer > visited_fields_.size()) {
       // Clear the current bits.
@@ -1641,9 +1644,10 @@ bool V8HeapExplorer::IterateAndExtractSinglePass() {
       DCHECK(!visited_fields_[i]);
     }
 
-    if (!progress_->ProgressReport(false)) interrupted = true;
+    if (!progress_->ProgressReport(false)) return true;
+    progress_->ProgressStep();
   }
-  return interrupted;
+  return false;
 }
 
 
@@ -2478,6 +2482,8 @@ bool HeapSnapshotGenerator::GenerateSnapshot() {
   }
 #endif
 
+  // This also collects the reachable objects for the V8 heap explorer. They
+  // must not move, so nothing may allocate until FillReferences.
   SetProgressTotal(2);  // 2 passes.
 
 #ifdef VERIFY_HEAP
@@ -2516,17 +2522,17 @@ bool HeapSnapshotGenerator::ProgressReport(bool force) {
 
 
 void HeapSnapshotGenerator::SetProgressTotal(int iterations_count) {
+  // The embedder is queried first because that may allocate, which would
+  // invalidate the reachable objects collected by the V8 heap explorer.
+  int objects_count = dom_explorer_.EstimateObjectsCount();
+  objects_count += v8_heap_explorer_.EstimateObjectsCount();
   if (control_ == nullptr) return;
-  HeapIterator iterator(heap_, HeapIterator::kFilterUnreachable);
   // The +1 ensures that intermediate ProgressReport calls will never signal
   // that the work is finished (i.e. progress_counter_ == progress_total_).
   // Only the forced ProgressReport() at the end of GenerateSnapshot()
   // should signal that the work is finished because signalling finished twice
   // breaks the DevTools frontend.
-  progress_total_ =
-      iterations_count * (v8_heap_explorer_.EstimateObjectsCount(&iterator) +
-                          dom_explorer_.EstimateObjectsCount()) +
-      1;
+  progress_total_ = iterations_count * objects_count + 1;
   progress_counter_ = 0;
 }
 
@@ -2572,6 +2578,15 @@ class OutputStreamWriter {
   void AddSubstring(const char* s, int n) {
     if (n <= 0) return;
     DCHECK(static_cast<size_t>(n) <= strlen(s));
+    AddBytes(s, n);
+  }
+  // Unlike the functions above, these accept arbitrary bytes including \0.
+  void AddByte(uint8_t b) {
+    DCHECK(chunk_pos_ < chunk_size_);
+    chunk_[chunk_pos_++] = static_cast<char>(b);
+    MaybeWriteChunk();
+  }
+  void AddBytes(const char* s, int n) {
     const char* s_end = s + n;
     while (s < s_end) {
       int s_chunk_size =
@@ -3090,5 +3105,128 @@ void HeapSnapshotJSONSerializer::SerializeStrings() {
 }
 
 
+const char HeapSnapshotBinarySerializer::kMagic[] = "V8HS";
+const int HeapSnapshotBinarySerializer::kVersion = 1;
+
+void HeapSnapshotBinarySerializer::Serialize(v8::OutputStream* stream) {
+  DCHECK_NULL(writer_);
+  writer_ = new OutputStreamWriter(stream);
+  SerializeImpl();
+  delete writer_;
+  writer_ = nullptr;
+}
+
+
+void HeapSnapshotBinarySerializer::SerializeImpl() {
+  DCHECK_EQ(0, snapshot_->root()->index());
+  const std::vector<HeapObjectsMap::TimeInterval>& samples =
+      snapshot_->profiler()->heap_object_map()->samples();
+  writer_->AddString(kMagic);
+  WriteVarint(kVersion);
+  WriteVarint(snapshot_->entries().size());
+  WriteVarint(snapshot_->edges().size());
+  WriteVarint(samples.size());
+  SerializeNodes();
+  if (writer_->aborted()) return;
+  SerializeEdges();
+  if (writer_->aborted()) return;
+  SerializeSamples();
+  if (writer_->aborted()) return;
+  SerializeStrings();
+  if (writer_->aborted()) return;
+  writer_->Finalize();
+}
+
+
+int HeapSnapshotBinarySerializer::GetStringId(const char* s) {
+  base::HashMap::Entry* cache_entry =
+      strings_.LookupOrInsert(const_cast<char*>(s), StringHash(s));
+  if (cache_entry->value == nullptr) {
+    cache_entry->value = reinterpret_cast<void*>(next_string_id_++);
+  }
+  return static_cast<int>(reinterpret_cast<intptr_t>(cache_entry->value));
+}
+
+
+void HeapSnapshotBinarySerializer::WriteVarint(uint64_t value) {
+  while (value >= 0x80) {
+    writer_->AddByte(static_cast<uint8_t>(value | 0x80));
+    value >>= 7;
+  }
+  writer_->AddByte(static_cast<uint8_t>(value));
+}
+
+
+void HeapSnapshotBinarySerializer::WriteSignedVarint(int64_t value) {
+  // Zigzag encoding keeps small negative deltas small.
+  WriteVarint((static_cast<uint64_t>(value) << 1) ^
+              static_cast<uint64_t>(value >> 63));
+}
+
+
+void HeapSnapshotBinarySerializer::SerializeNodes() {
+  // Object ids are assigned in allocation order and mostly grow along the
+  // entries vector, so consecutive ids are stored as deltas.
+  SnapshotObjectId previous_id = 0;
+  for (const HeapEntry& entry : snapshot_->entries()) {
+    WriteVarint(entry.type());
+    WriteVarint(GetStringId(entry.name()));
+    WriteSignedVarint(static_cast<int64_t>(entry.id()) -
+                      static_cast<int64_t>(previous_id));
+    WriteVarint(entry.self_size());
+    WriteVarint(entry.children_count());
+    WriteVarint(entry.trace_node_id());
+    previous_id = entry.id();
+    if (writer_->aborted()) return;
+  }
+}
+
+
+void HeapSnapshotBinarySerializer::SerializeEdges() {
+  std::deque<HeapGraphEdge*>& edges = snapshot_->children();
+  for (size_t i = 0; i < edges.size(); ++i) {
+    HeapGraphEdge* edge = edges[i];
+    DCHECK(i == 0 || edges[i - 1]->from()->index() <= edge->from()->index());
+    WriteVarint(edge->type());
+    WriteVarint(edge->type() == HeapGraphEdge::kElement ||
+                        edge->type() == HeapGraphEdge::kHidden
+                    ? edge->index()
+                    : GetStringId(edge->name()));
+    WriteVarint(edge->to()->index());
+    if (writer_->aborted()) return;
+  }
+}
+
+
+void HeapSnapshotBinarySerializer::SerializeSamples() {
+  const std::vector<HeapObjectsMap::TimeInterval>& samples =
+      snapshot_->profiler()->heap_object_map()->samples();
+  if (samples.empty()) return;
+  base::TimeTicks start_time = samples[0].timestamp;
+  for (const HeapObjectsMap::TimeInterval& sample : samples) {
+    WriteVarint((sample.timestamp - start_time).InMicroseconds());
+    WriteVarint(sample.last_assigned_id());
+  }
+}
+
+
+void HeapSnapshotBinarySerializer::SerializeStrings() {
+  ScopedVector<const char*> sorted_strings(strings_.occupancy() + 1);
+  for (base::HashMap::Entry* entry = strings_.Start(); entry != nullptr;
+       entry = strings_.Next(entry)) {
+    int index = static_cast<int>(reinterpret_cast<uintptr_t>(entry->value));
+    sorted_strings[index] = reinterpret_cast<const char*>(entry->key);
+  }
+  // Index 0 is reserved, as in the JSON format, and is not written.
+  WriteVarint(sorted_strings.length() - 1);
+  for (int i = 1; i < sorted_strings.length(); ++i) {
+    int length = StrLength(sorted_strings[i]);
+    WriteVarint(length);
+    writer_->AddBytes(sorted_strings[i], length);
+    if (writer_->aborted()) return;
+  }
+}
+
+
 }  // namespace internal
 }  // namespace v8
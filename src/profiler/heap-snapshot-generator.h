@@ -341,7 +341,10 @@ class V8HeapExplorer : public HeapEntriesAllocator {
                  v8::HeapProfiler::ObjectNameResolver* resolver);
   virtual ~V8HeapExplorer();
   virtual HeapEntry* AllocateEntry(HeapThing ptr);
-  int EstimateObjectsCount(HeapIterator* iterator);
+  // Collects the objects reachable from the roots, which are then visited by
+  // both extraction passes, and returns their number. Nothing may allocate on
+  // the heap between this call and IterateAndExtractReferences.
+  int EstimateObjectsCount();
   bool IterateAndExtractReferences(SnapshotFiller* filler);
   void TagGlobalObjects();
   void TagCodeObject(Code* code);
@@ -476,6 +479,10 @@ class V8HeapExplorer : public HeapEntriesAllocator {
   v8::HeapProfiler::ObjectNameResolver* global_object_name_resolver_;
 
   std::vector<bool> visited_fields_;
+  // Objects visited by the extraction passes. Finding them requires marking
+  // the whole heap, so it is only done once per snapshot.
+  std::vector<HeapObject*> reachable_objects_;
+  bool reachable_objects_collected_;
 
   friend class IndexedReferencesExtractor;
   friend class RootsReferencesExtractor;
@@ -630,6 +637,62 @@ class HeapSnapshotJSONSerializer {
   DISALLOW_COPY_AND_ASSIGN(HeapSnapshotJSONSerializer);
 };
 
+// Writes the snapshot in the compact binary format. All integers are
+// LEB128 varints; the layout is
+//
+//   "V8HS" version node_count edge_count sample_count
+//   nodes:   type name_string id_delta self_size edge_count trace_node_id
+//   edges:   type name_string_or_index to_node_index
+//   samples: timestamp_us last_assigned_id
+//   strings: count (length utf8_bytes)*
+//
+// Node ids are zigzag-encoded deltas from the previous node's id. String
+// references index the trailing string table starting at 1. Everything is
+// streamed through the output chunks, so apart from the string ids no
+// serialization state proportional to the snapshot is kept.
+// tools/heap-snapshot-binary-to-json.py converts the result to JSON.
+class HeapSnapshotBinarySerializer {
+ public:
+  explicit HeapSnapshotBinarySerializer(HeapSnapshot* snapshot)
+      : snapshot_(snapshot),
+        strings_(StringsMatch),
+        next_string_id_(1),
+        writer_(nullptr) {}
+  void Serialize(v8::OutputStream* stream);
+
+  static const char kMagic[];
+  static const int kVersion;
+
+ private:
+  INLINE(static bool StringsMatch(void* key1, void* key2)) {
+    return strcmp(reinterpret_cast<char*>(key1),
+                  reinterpret_cast<char*>(key2)) == 0;
+  }
+
+  INLINE(static uint32_t StringHash(const void* string)) {
+    const char* s = reinterpret_cast<const char*>(string);
+    int len = static_cast<int>(strlen(s));
+    return StringHasher::HashSequentialString(
+        s, len, v8::internal::kZeroHashSeed);
+  }
+
+  int GetStringId(const char* s);
+  void WriteVarint(uint64_t value);
+  void WriteSignedVarint(int64_t value);
+  void SerializeImpl();
+  void SerializeNodes();
+  void SerializeEdges();
+  void SerializeSamples();
+  void SerializeStrings();
+
+  HeapSnapshot* snapshot_;
+  base::CustomMatcherHashMap strings_;
+  int next_string_id_;
+  OutputStreamWriter* writer_;
+
+  DISALLOW_COPY_AND_ASSIGN(HeapSnapshotBinarySerializer);
+};
+
 
 }  // namespace internal
 }  // namespace v8
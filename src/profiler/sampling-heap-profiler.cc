@@ -60,7 +60,9 @@ SamplingHeapProfiler::SamplingHeapProfiler(
           heap_, static_cast<intptr_t>(rate), rate, this,
           heap->isolate()->random_number_generator())),
       names_(names),
-      profile_root_(nullptr, "(root)", v8::UnboundScript::kNoScriptId, 0),
+      next_node_id_(0),
+      profile_root_(nullptr, "(root)", v8::UnboundScript::kNoScriptId, 0,
+                    next_node_id_++),
       samples_(),
       stack_depth_(stack_depth),
       rate_(rate),
@@ -130,17 +132,19 @@ void SamplingHeapProfiler::OnWeakCallback(
 }
 
 SamplingHeapProfiler::AllocationNode*
-SamplingHeapProfiler::AllocationNode::FindOrAddChildNode(const char* name,
-                                                         int script_id,
-                                                         int start_position) {
-  FunctionId id = function_id(script_id, start_position, name);
-  auto it = children_.find(id);
-  if (it != children_.end()) {
+SamplingHeapProfiler::FindOrAddChildNode(AllocationNode* parent,
+                                         const char* name, int script_id,
+                                         int start_position) {
+  AllocationNode::FunctionId id =
+      AllocationNode::function_id(script_id, start_position, name);
+  auto it = parent->children_.find(id);
+  if (it != parent->children_.end()) {
     DCHECK_EQ(strcmp(it->second->name_, name), 0);
     return it->second;
   }
-  auto child = new AllocationNode(this, name, script_id, start_position);
-  children_.insert(std::make_pair(id, child));
+  auto child = new AllocationNode(parent, name, script_id, start_position,
+                                  next_node_id_++);
+  parent->children_.insert(std::make_pair(id, child));
   return child;
 }
 
@@ -196,7 +200,7 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
         name = "(JS)";
         break;
     }
-    return node->FindOrAddChildNode(name, v8::UnboundScript::kNoScriptId, 0);
+    return FindOrAddChildNode(node, name, v8::UnboundScript::kNoScriptId, 0);
   }
 
   // We need to process the stack in reverse order as the top of the stack is
@@ -209,12 +213,12 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
       Script* script = Script::cast(shared->script());
       script_id = script->id();
     }
-    node = node->FindOrAddChildNode(name, script_id, shared->StartPosition());
+    node = FindOrAddChildNode(node, name, script_id, shared->StartPosition());
   }
 
   if (found_arguments_marker_frames) {
-    node =
-        node->FindOrAddChildNode("(deopt)", v8::UnboundScript::kNoScriptId, 0);
+    node = FindOrAddChildNode(node, "(deopt)", v8::UnboundScript::kNoScriptId,
+                              0);
   }
 
   return node;
@@ -222,7 +226,8 @@ SamplingHeapProfiler::AllocationNode* SamplingHeapProfiler::AddStack() {
 
 v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
     AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
-    const std::map<int, Handle<Script>>& scripts) {
+    const std::map<int, Handle<Script>>& scripts,
+    const AllocationCounts& counts, TranslatedNodes* translated) {
   // By pinning the node we make sure its children won't get disposed if
   // a GC kicks in during the tree retrieval.
   node->pinned_ = true;
@@ -231,7 +236,6 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
   int line = v8::AllocationProfile::kNoLineNumberInfo;
   int column = v8::AllocationProfile::kNoColumnNumberInfo;
   std::vector<v8::AllocationProfile::Allocation> allocations;
-  allocations.reserve(node->allocations_.size());
   if (node->script_id_ != v8::UnboundScript::kNoScriptId &&
       scripts.find(node->script_id_) != scripts.end()) {
     // Cannot use std::map<T>::at because it is not available on android.
@@ -248,8 +252,12 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
       column = 1 + Script::GetColumnNumber(script, node->script_position_);
     }
   }
-  for (auto alloc : node->allocations_) {
-    allocations.push_back(ScaleSample(alloc.first, alloc.second));
+  auto node_counts = counts.find(node->id_);
+  if (node_counts != counts.end()) {
+    allocations.reserve(node_counts->second.size());
+    for (auto alloc : node_counts->second) {
+      allocations.push_back(ScaleSample(alloc.first, alloc.second));
+    }
   }
 
   profile->nodes().push_back(v8::AllocationProfile::Node(
@@ -258,19 +266,21 @@ v8::AllocationProfile::Node* SamplingHeapProfiler::TranslateAllocationNode(
        script_name, node->script_id_, node->script_position_, line, column,
        std::vector<v8::AllocationProfile::Node*>(), allocations}));
   v8::AllocationProfile::Node* current = &profile->nodes().back();
+  (*translated)[node->id_] = current;
   // The children map may have nodes inserted into it during translation
   // because the translation may allocate strings on the JS heap that have
   // the potential to be sampled. That's ok since map iterators are not
   // invalidated upon std::map insertion.
   for (auto it : node->children_) {
-    current->children.push_back(
-        TranslateAllocationNode(profile, it.second, scripts));
+    current->children.push_back(TranslateAllocationNode(
+        profile, it.second, scripts, counts, translated));
   }
   node->pinned_ = false;
   return current;
 }
 
-v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
+v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile(
+    unsigned int min_gcs_survived) {
   if (flags_ & v8::HeapProfiler::kSamplingForceGC) {
     isolate_->heap()->CollectAllGarbage(
         Heap::kNoGCFlags, GarbageCollectionReason::kSamplingProfiler);
@@ -284,8 +294,31 @@ v8::AllocationProfile* SamplingHeapProfiler::GetAllocationProfile() {
       scripts[script->id()] = handle(script);
     }
   }
+  // Only samples that are old enough contribute to the self allocations.
+  // Counts are keyed by node id because translation may allocate and thereby
+  // trigger a GC that disposes of nodes.
+  AllocationCounts counts;
+  for (const std::unique_ptr<Sample>& sample : samples_) {
+    if (sample->gcs_survived() < min_gcs_survived) continue;
+    counts[sample->owner->id_][sample->size]++;
+  }
   auto profile = new v8::internal::AllocationProfile();
-  TranslateAllocationNode(profile, &profile_root_, scripts);
+  TranslatedNodes translated;
+  TranslateAllocationNode(profile, &profile_root_, scripts, counts,
+                          &translated);
+  {
+    DisallowHeapAllocation no_allocation;
+    for (const std::unique_ptr<Sample>& sample : samples_) {
+      unsigned int gcs_survived = sample->gcs_survived();
+      if (gcs_survived < min_gcs_survived) continue;
+      // Samples taken during the translation have no node in the profile.
+      auto node = translated.find(sample->owner->id_);
+      if (node == translated.end()) continue;
+      profile->samples().push_back({node->second, sample->size,
+                                    sample->allocation_time_ms,
+                                    gcs_survived});
+    }
+  }
   return profile;
 }
 
@@ -31,10 +31,16 @@ class AllocationProfile : public v8::AllocationProfile {
     return nodes_.size() == 0 ? nullptr : &nodes_.front();
   }
 
+  const std::vector<v8::AllocationProfile::Sample>& GetSamples() override {
+    return samples_;
+  }
+
   std::deque<v8::AllocationProfile::Node>& nodes() { return nodes_; }
+  std::vector<v8::AllocationProfile::Sample>& samples() { return samples_; }
 
  private:
   std::deque<v8::AllocationProfile::Node> nodes_;
+  std::vector<v8::AllocationProfile::Sample> samples_;
 
   DISALLOW_COPY_AND_ASSIGN(AllocationProfile);
 };
@@ -45,7 +51,7 @@ class SamplingHeapProfiler {
                        int stack_depth, v8::HeapProfiler::SamplingFlags flags);
   ~SamplingHeapProfiler();
 
-  v8::AllocationProfile* GetAllocationProfile();
+  v8::AllocationProfile* GetAllocationProfile(unsigned int min_gcs_survived);
 
   StringsStorage* names() const { return names_; }
 
@@ -59,12 +65,22 @@ class SamplingHeapProfiler {
           owner(owner_),
           global(Global<Value>(
               reinterpret_cast<v8::Isolate*>(profiler_->isolate_), local_)),
-          profiler(profiler_) {}
+          profiler(profiler_),
+          allocation_time_ms(
+              profiler_->heap()->MonotonicallyIncreasingTimeInMs()),
+          ms_count(profiler_->heap()->ms_count()) {}
     ~Sample() { global.Reset(); }
+    // The number of mark-compacts the sampled object has lived through.
+    unsigned int gcs_survived() const {
+      return static_cast<unsigned int>(profiler->heap()->ms_count() - ms_count);
+    }
     const size_t size;
     AllocationNode* const owner;
     Global<Value> global;
     SamplingHeapProfiler* const profiler;
+    const double allocation_time_ms;
+    // Value of Heap::ms_count() when the object was sampled.
+    const int ms_count;
 
    private:
     DISALLOW_COPY_AND_ASSIGN(Sample);
@@ -73,11 +89,12 @@ class SamplingHeapProfiler {
   class AllocationNode {
    public:
     AllocationNode(AllocationNode* parent, const char* name, int script_id,
-                   int start_position)
+                   int start_position, uint32_t id)
         : parent_(parent),
           script_id_(script_id),
           script_position_(start_position),
           name_(name),
+          id_(id),
           pinned_(false) {}
     ~AllocationNode() {
       for (auto child : children_) {
@@ -102,8 +119,6 @@ class SamplingHeapProfiler {
       DCHECK(static_cast<unsigned>(start_position) < (1u << 31));
       return (static_cast<uint64_t>(script_id) << 32) + (start_position << 1);
     }
-    AllocationNode* FindOrAddChildNode(const char* name, int script_id,
-                                       int start_position);
     // TODO(alph): make use of unordered_map's here. Pay attention to
     // iterator invalidation during TranslateAllocationNode.
     std::map<size_t, unsigned int> allocations_;
@@ -112,6 +127,8 @@ class SamplingHeapProfiler {
     const int script_id_;
     const int script_position_;
     const char* const name_;
+    // Unlike the node's address, the id is never reused after the node dies.
+    const uint32_t id_;
     bool pinned_;
 
     friend class SamplingHeapProfiler;
@@ -128,23 +145,33 @@ class SamplingHeapProfiler {
 
   // Methods that construct v8::AllocationProfile.
 
+  // Maps AllocationNode ids to the sampled allocation counts by size.
+  typedef std::map<uint32_t, std::map<size_t, unsigned int>> AllocationCounts;
+  // Maps AllocationNode ids to their translated nodes.
+  typedef std::map<uint32_t, v8::AllocationProfile::Node*> TranslatedNodes;
+
   // Translates the provided AllocationNode *node* returning an equivalent
   // AllocationProfile::Node. The newly created AllocationProfile::Node is added
   // to the provided AllocationProfile *profile*. Line numbers, column numbers,
   // and script names are resolved using *scripts* which maps all currently
-  // loaded scripts keyed by their script id.
+  // loaded scripts keyed by their script id. Self allocations are taken from
+  // *counts*, and every translated node is recorded in *translated*.
   v8::AllocationProfile::Node* TranslateAllocationNode(
       AllocationProfile* profile, SamplingHeapProfiler::AllocationNode* node,
-      const std::map<int, Handle<Script>>& scripts);
+      const std::map<int, Handle<Script>>& scripts,
+      const AllocationCounts& counts, TranslatedNodes* translated);
   v8::AllocationProfile::Allocation ScaleSample(size_t size,
                                                 unsigned int count);
   AllocationNode* AddStack();
+  AllocationNode* FindOrAddChildNode(AllocationNode* parent, const char* name,
+                                     int script_id, int start_position);
 
   Isolate* const isolate_;
   Heap* const heap_;
   std::unique_ptr<SamplingAllocationObserver> new_space_observer_;
   std::unique_ptr<SamplingAllocationObserver> other_spaces_observer_;
   StringsStorage* const names_;
+  uint32_t next_node_id_;
   AllocationNode profile_root_;
   std::set<std::unique_ptr<Sample>> samples_;
   const int stack_depth_;
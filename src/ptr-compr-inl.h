@@ -0,0 +1,69 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PTR_COMPR_INL_H_
+#define V8_PTR_COMPR_INL_H_
+
+#include "src/ptr-compr.h"
+
+#if V8_TARGET_ARCH_64_BIT
+
+namespace v8 {
+namespace internal {
+
+Address GetRootFromOnHeapAddress(Address addr) {
+  return RoundDown(addr + kPtrComprIsolateRootBias,
+                   kPtrComprIsolateRootAlignment);
+}
+
+int32_t CompressTagged(Address tagged) {
+  // The isolate root is 4GB aligned, so the offset from the root is just the
+  // lower half of the full value.
+  if ((tagged & kSmiTagMask) != kSmiTag) {
+    return static_cast<int32_t>(static_cast<uint32_t>(tagged));
+  }
+  // Smis are stored in the 31-bit layout. With 32-bit Smis the value sits in
+  // the upper half of the word, so it is shifted down first.
+  intptr_t value =
+      static_cast<intptr_t>(tagged) >> (kSmiTagSize + kSmiShiftSize);
+  DCHECK(SmiTagging<4>::IsValidSmi(value));
+  return static_cast<int32_t>(static_cast<uint32_t>(value) << kSmiTagSize);
+}
+
+Address DecompressTaggedPointer(Address on_heap_addr, int32_t raw_value) {
+  // Current compression scheme requires |raw_value| to be sign-extended
+  // from int32_t to intptr_t.
+  intptr_t value = static_cast<intptr_t>(raw_value);
+  Address root = GetRootFromOnHeapAddress(on_heap_addr);
+  return root + static_cast<Address>(value);
+}
+
+Address DecompressTaggedSigned(int32_t raw_value) {
+  // Convert from the 31-bit layout back to the platform Smi layout. This is
+  // a plain sign extension when Smis are 31-bit.
+  intptr_t value = static_cast<intptr_t>(raw_value) >> kSmiTagSize;
+  return static_cast<Address>(value) << (kSmiTagSize + kSmiShiftSize);
+}
+
+Address DecompressTaggedAny(Address on_heap_addr, int32_t raw_value) {
+  if (SmiValuesAre32Bits() && (raw_value & kSmiTagMask) == kSmiTag) {
+    return DecompressTaggedSigned(raw_value);
+  }
+  // Current compression scheme requires |raw_value| to be sign-extended
+  // from int32_t to intptr_t.
+  intptr_t value = static_cast<intptr_t>(raw_value);
+  // Branchlessly compute the mask: all ones for heap objects, all zeros for
+  // Smis, and use it to decide whether the root has to be added.
+  STATIC_ASSERT(kSmiTag == 0 && kHeapObjectTag == 1);
+  intptr_t root_mask = -(value & kSmiTagMask);
+  Address root = GetRootFromOnHeapAddress(on_heap_addr);
+  return (root & static_cast<Address>(root_mask)) + static_cast<Address>(value);
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_64_BIT
+
+#endif  // V8_PTR_COMPR_INL_H_
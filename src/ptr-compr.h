@@ -0,0 +1,49 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_PTR_COMPR_H_
+#define V8_PTR_COMPR_H_
+
+#include "src/globals.h"
+
+#if V8_TARGET_ARCH_64_BIT
+
+namespace v8 {
+namespace internal {
+
+// With pointer compression all heap objects of an isolate live inside one
+// contiguous 4GB reservation. The isolate root is placed in the middle of
+// that reservation, so that every on-heap address can be expressed as a
+// signed 32-bit offset from the root.
+constexpr size_t kPtrComprHeapReservationSize = size_t{4} * GB;
+constexpr size_t kPtrComprIsolateRootBias = kPtrComprHeapReservationSize / 2;
+constexpr size_t kPtrComprIsolateRootAlignment = size_t{4} * GB;
+
+// Returns the isolate root for any address inside the heap reservation.
+V8_INLINE Address GetRootFromOnHeapAddress(Address addr);
+
+// Compresses a full tagged value (Smi or heap object pointer) into its
+// 32-bit on-heap representation. Compressed Smis always use the 31-bit
+// layout, so with 32-bit Smis only values in the 31-bit range can be
+// compressed.
+V8_INLINE int32_t CompressTagged(Address tagged);
+
+// Decompresses a value known to be a heap object pointer. |on_heap_addr| is
+// any address inside the same heap reservation, typically the address of the
+// field the value was loaded from.
+V8_INLINE Address DecompressTaggedPointer(Address on_heap_addr,
+                                          int32_t raw_value);
+
+// Decompresses a value known to be a Smi.
+V8_INLINE Address DecompressTaggedSigned(int32_t raw_value);
+
+// Decompresses a value that may be either a Smi or a heap object pointer.
+V8_INLINE Address DecompressTaggedAny(Address on_heap_addr, int32_t raw_value);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_64_BIT
+
+#endif  // V8_PTR_COMPR_H_
@@ -471,9 +471,16 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     site = Handle<AllocationSite>::cast(literal_site);
     boilerplate = Handle<JSObject>(site->boilerplate(), isolate);
   } else {
+    // A pretenuring hint from the code cache means that the site was tenured
+    // in a previous process. Start out with that decision.
+    bool pretenuring_hint =
+        FLAG_allocation_site_pretenuring &&
+        FLAG_code_cache_pretenuring_hints &&
+        vector->metadata()->HasPretenuringHint(literals_slot);
     // Eagerly create AllocationSites for literals that contain an Array.
     bool needs_initial_allocation_site =
-        (flags & AggregateLiteral::kNeedsInitialAllocationSite) != 0;
+        (flags & AggregateLiteral::kNeedsInitialAllocationSite) != 0 ||
+        pretenuring_hint;
     // TODO(cbruni): Even in the case where we need an initial allocation site
     // we could still create the boilerplate lazily to save memory.
     if (!needs_initial_allocation_site &&
@@ -489,7 +496,9 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
       return boilerplate;
     } else {
       PretenureFlag pretenure_flag =
-          isolate->heap()->InNewSpace(*vector) ? NOT_TENURED : TENURED;
+          isolate->heap()->InNewSpace(*vector) && !pretenuring_hint
+              ? NOT_TENURED
+              : TENURED;
       boilerplate =
           Boilerplate::Create(isolate, description, flags, pretenure_flag);
     }
@@ -499,6 +508,11 @@ MaybeHandle<JSObject> CreateLiteral(Isolate* isolate,
     RETURN_ON_EXCEPTION(isolate, DeepWalk(boilerplate, &creation_context),
                         JSObject);
     creation_context.ExitScope(site, boilerplate);
+    if (pretenuring_hint) {
+      site->set_pretenure_decision(AllocationSite::kTenure);
+      // The site carries the decision from now on.
+      vector->metadata()->SetPretenuringHint(literals_slot, false);
+    }
 
     vector->Set(literals_slot, *site);
   }
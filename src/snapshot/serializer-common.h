@@ -106,7 +106,10 @@ class SerializerDeserializer : public RootVisitor {
   // We also handle map space differenly.
   STATIC_ASSERT(MAP_SPACE == CODE_SPACE + 1);
   static const int kNumberOfPreallocatedSpaces = CODE_SPACE + 1;
-  static const int kNumberOfSpaces = LAST_SPACE + 1;
+  // Young generation large objects are serialized into the large object
+  // space, so the snapshot does not know about the new large object space.
+  STATIC_ASSERT(NEW_LO_SPACE == LO_SPACE + 1);
+  static const int kNumberOfSpaces = LO_SPACE + 1;
 
  protected:
   static bool CanBeDeferred(HeapObject* o);
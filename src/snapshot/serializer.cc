@@ -643,6 +643,8 @@ void Serializer<AllocatorT>::ObjectSerializer::SerializeObject() {
   Map* map = object_->map();
   AllocationSpace space =
       MemoryChunk::FromAddress(object_->address())->owner()->identity();
+  // Young generation large objects are deserialized as old large objects.
+  if (space == NEW_LO_SPACE) space = LO_SPACE;
   SerializePrologue(space, size, map);
 
   // Serialize the rest of the object.
@@ -14,6 +14,7 @@
   V(CompactionPartiallyAbortedPage)                       \
   V(CompactionPartiallyAbortedPageIntraAbortedPointers)   \
   V(CompactionPartiallyAbortedPageWithStoreBufferEntries) \
+  V(CompactionPauseTargetLimitsCandidates)                \
   V(CompactionSpaceDivideMultiplePages)                   \
   V(CompactionSpaceDivideSinglePage)                      \
   V(InvalidatedSlotsAfterTrimming)                        \
@@ -361,6 +361,74 @@ HEAP_TEST(CompactionPartiallyAbortedPageWithStoreBufferEntries) {
   }
 }
 
+namespace {
+
+int CountOldSpaceEvacuationCandidates(Heap* heap) {
+  MarkCompactCollector* collector = heap->mark_compact_collector();
+  CHECK(collector->StartCompaction());
+  int count = 0;
+  for (Page* page : *heap->old_space()) {
+    if (page->IsEvacuationCandidate()) count++;
+  }
+  collector->AbortCompaction();
+  return count;
+}
+
+}  // namespace
+
+HEAP_TEST(CompactionPauseTargetLimitsCandidates) {
+  if (FLAG_never_compact || FLAG_always_compact) return;
+  ManualGCScope manual_gc_scope;
+  FLAG_manual_evacuation_candidates_selection = true;
+  FLAG_compaction_pause_target_ms = 0;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope1(isolate);
+
+  const int kPages = 8;
+  const int kObjectsPerPage = 10;
+  const int kLiveObjectsPerPage = 2;
+  const int object_size = Page::kAllocatableMemory / kObjectsPerPage;
+  Handle<FixedArray> holder =
+      isolate->factory()->NewFixedArray(kPages * kLiveObjectsPerPage, TENURED);
+  heap::SealCurrentObjects(heap);
+
+  // Leave every page 20% live.
+  for (int i = 0; i < kPages; i++) {
+    HandleScope scope2(isolate);
+    CHECK(heap->old_space()->Expand());
+    std::vector<Handle<FixedArray>> handles = heap::CreatePadding(
+        heap, Page::kAllocatableMemory, TENURED, object_size);
+    for (int j = 0; j < kLiveObjectsPerPage; j++) {
+      holder->set(i * kLiveObjectsPerPage + j, *handles[j]);
+    }
+  }
+  CcTest::CollectAllGarbage();
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+  FLAG_manual_evacuation_candidates_selection = false;
+
+  // A fast compaction speed makes every 20% live page fragmented enough.
+  const size_t area_size = static_cast<size_t>(heap->old_space()->AreaSize());
+  for (int i = 0; i < 10; i++) {
+    heap->tracer()->AddCompactionEvent(1, 1024 * MB);
+  }
+  const int unlimited = CountOldSpaceEvacuationCandidates(heap);
+  CHECK_LE(kPages - 1, unlimited);
+
+  // Evacuating one page worth of live bytes takes the whole target, so only
+  // five of the 20% live pages fit.
+  for (int i = 0; i < 10; i++) {
+    heap->tracer()->AddEvacuationPauseEvent(1, area_size);
+  }
+  FLAG_compaction_pause_target_ms = 1;
+  const int limited = CountOldSpaceEvacuationCandidates(heap);
+  CHECK_LT(0, limited);
+  CHECK_LT(limited, unlimited);
+  CHECK_LE(static_cast<size_t>(limited * kLiveObjectsPerPage * object_size),
+           area_size);
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
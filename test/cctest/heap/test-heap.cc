@@ -43,6 +43,7 @@
 #include "src/heap/incremental-marking.h"
 #include "src/heap/mark-compact.h"
 #include "src/heap/memory-reducer.h"
+#include "src/heap/scavenge-job.h"
 #include "src/ic/ic.h"
 #include "src/macro-assembler-inl.h"
 #include "src/objects-inl.h"
@@ -2216,6 +2217,53 @@ TEST(IdleNotificationFinishMarking) {
 }
 
 
+TEST(PerformIdleGarbageCollection) {
+  if (!FLAG_incremental_marking) return;
+  ManualGCScope manual_gc_scope;
+  CcTest::InitializeVM();
+  Heap* heap = CcTest::heap();
+  const double kLongIdleTime = 1.0;
+  v8::IdleGarbageCollectionStatistics statistics;
+
+  // Without pending work there is nothing to do.
+  CcTest::CollectAllGarbage();
+  heap->mark_compact_collector()->EnsureSweepingCompleted();
+  CHECK(CcTest::isolate()->PerformIdleGarbageCollection(
+      heap->MonotonicallyIncreasingTimeInMs() / 1000.0 + kLongIdleTime, false,
+      &statistics));
+  CHECK(!statistics.finalized_sweeping());
+  CHECK_EQ(0, statistics.scavenges());
+  CHECK_EQ(0, statistics.full_gcs());
+
+  // A quiescent period empties the young generation.
+  {
+    HandleScope scope(CcTest::i_isolate());
+    while (heap->new_space()->Size() < ScavengeJob::kMinAllocationLimit) {
+      CcTest::i_isolate()->factory()->NewFixedArray(1024);
+    }
+  }
+  CcTest::isolate()->PerformIdleGarbageCollection(
+      heap->MonotonicallyIncreasingTimeInMs() / 1000.0 + kLongIdleTime, true,
+      &statistics);
+  CHECK_EQ(1, statistics.scavenges());
+
+  // Running incremental marking is finished within the idle time.
+  if (heap->incremental_marking()->IsStopped()) {
+    heap->StartIncrementalMarking(i::Heap::kNoGCFlags,
+                                  i::GarbageCollectionReason::kTesting);
+  }
+  int full_gcs = 0;
+  for (int i = 0; i < 100 && full_gcs == 0; i++) {
+    CcTest::isolate()->PerformIdleGarbageCollection(
+        heap->MonotonicallyIncreasingTimeInMs() / 1000.0 + kLongIdleTime,
+        false, &statistics);
+    full_gcs += statistics.full_gcs();
+  }
+  CHECK_EQ(1, full_gcs);
+  CHECK(heap->incremental_marking()->IsStopped());
+}
+
+
 // Test that HAllocateObject will always return an object in new-space.
 TEST(OptimizedAllocationAlwaysInNewSpace) {
   FLAG_allow_natives_syntax = true;
@@ -6105,6 +6153,204 @@ UNINITIALIZED_TEST(OutOfMemoryLargeObjects) {
   reinterpret_cast<v8::Isolate*>(isolate)->Dispose();
 }
 
+TEST(YoungGenerationLargeObjectAllocation) {
+  FLAG_young_generation_large_objects = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  Heap* heap = CcTest::heap();
+  if (heap->use_minor_mc()) return;
+  Isolate* isolate = heap->isolate();
+
+  Handle<FixedArray> array = isolate->factory()->NewFixedArray(200000);
+  MemoryChunk* chunk = MemoryChunk::FromAddress(array->address());
+  CHECK_EQ(NEW_LO_SPACE, chunk->owner()->identity());
+  CHECK(chunk->IsFlagSet(MemoryChunk::IN_TO_SPACE));
+
+  Handle<FixedArray> array_small = isolate->factory()->NewFixedArray(20000);
+  chunk = MemoryChunk::FromAddress(array_small->address());
+  CHECK_EQ(NEW_SPACE, chunk->owner()->identity());
+  CHECK(chunk->IsFlagSet(MemoryChunk::IN_TO_SPACE));
+
+  Handle<Object> number = isolate->factory()->NewHeapNumber(123.456);
+  array->set(0, *number);
+
+  {
+    HandleScope inner_scope(isolate);
+    Handle<FixedArray> dead = isolate->factory()->NewFixedArray(200000);
+    CHECK(heap->new_lo_space()->Contains(*dead));
+  }
+
+  CcTest::CollectGarbage(NEW_SPACE);
+
+  // The surviving array is promoted in place to the old generation large
+  // object space and the dead one is released.
+  chunk = MemoryChunk::FromAddress(array->address());
+  CHECK_EQ(LO_SPACE, chunk->owner()->identity());
+  CHECK(!chunk->InNewSpace());
+  CHECK(heap->new_lo_space()->IsEmpty());
+  CHECK_EQ(*number, array->get(0));
+  CHECK_EQ(123.456, array->get(0)->Number());
+  CcTest::CollectAllAvailableGarbage();
+}
+
+UNINITIALIZED_TEST(ConcurrentCodeSpaceSweeping) {
+  if (!FLAG_concurrent_sweeping || !FLAG_opt) return;
+  // Code pages are only swept on the sweeper tasks when they stay executable.
+  FLAG_concurrent_code_space_sweeping = true;
+  FLAG_write_protect_code_memory = false;
+  FLAG_allow_natives_syntax = true;
+  FLAG_manual_evacuation_candidates_selection = true;
+  FLAG_stress_incremental_marking = false;
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope handle_scope(isolate);
+    v8::Local<v8::Context> context = v8::Context::New(isolate);
+    v8::Context::Scope context_scope(context);
+    Heap* heap = reinterpret_cast<Isolate*>(isolate)->heap();
+    MarkCompactCollector* collector = heap->mark_compact_collector();
+    CHECK(collector->sweeper()->ShouldSweepCodeSpaceConcurrently());
+
+    // The dead optimized code of g gives the sweeper something to free on
+    // the code page of f.
+    CompileRun(
+        "function f(x) { return x + 1; }"
+        "function g(x) { return x * 2; }"
+        "%OptimizeFunctionOnNextCall(f); f(1);"
+        "%OptimizeFunctionOnNextCall(g); g(1); g = null;");
+    v8::Local<v8::Function> f = v8::Local<v8::Function>::Cast(
+        context->Global()->Get(context, v8_str("f")).ToLocalChecked());
+    Handle<JSFunction> function =
+        Handle<JSFunction>::cast(v8::Utils::OpenHandle(*f));
+    CHECK(function->IsOptimized());
+    Page* page = Page::FromAddress(function->code()->address());
+    CHECK_EQ(CODE_SPACE, page->owner()->identity());
+
+    heap->CollectAllGarbage(Heap::kNoGCFlags,
+                            GarbageCollectionReason::kTesting);
+    if (collector->sweeping_in_progress()) {
+      // Run f from its page while the sweeper tasks sweep that page. The
+      // main thread does not help with sweeping code space.
+      v8::Local<v8::Value> args[] = {v8_num(1)};
+      do {
+        v8::Local<v8::Value> result =
+            f->Call(context, context->Global(), 1, args).ToLocalChecked();
+        CHECK_EQ(2, result->Int32Value(context).FromJust());
+      } while (!page->SweepingDone());
+      CHECK(function->IsOptimized());
+      collector->EnsureSweepingCompleted();
+    }
+  }
+  isolate->Dispose();
+}
+
+TEST(SampledHeapObjectStatistics) {
+  FLAG_object_stats_sampling_rate = 1;
+  CcTest::InitializeVM();
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope scope(isolate);
+  CompileRun("function f() { return 1; } f();");
+  CcTest::CollectAllGarbage();
+
+  // Every page is sampled, so the statistics are exact.
+  v8::HeapObjectStatistics stats;
+  CHECK(isolate->GetSampledHeapObjectStatisticsAtLastGC(&stats,
+                                                        BYTECODE_ARRAY_TYPE));
+  CHECK_EQ(0, strcmp("BYTECODE_ARRAY_TYPE", stats.object_type()));
+  CHECK_GT(stats.object_count(), 0);
+  CHECK_GT(stats.object_size(), 0);
+  size_t histogram_count = 0;
+  for (size_t i = 0; i < v8::HeapObjectStatistics::kSizeBucketCount; i++) {
+    histogram_count += stats.object_count_in_size_bucket(i);
+  }
+  CHECK_EQ(stats.object_count(), histogram_count);
+  CHECK(!isolate->GetSampledHeapObjectStatisticsAtLastGC(
+      &stats, isolate->NumberOfTrackedHeapObjectTypes()));
+
+  // With sampling the estimates are scaled by the sampling rate. Compare them
+  // against an exact collection in the same GC for a type that is spread
+  // evenly over many old space pages.
+  FLAG_gc_stats = 1;
+  FLAG_object_stats_sampling_rate = 4;
+  CompileRun(
+      "var symbols = [];"
+      "for (var i = 0; i < 300000; i++) symbols.push(Symbol());");
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+  v8::HeapObjectStatistics exact;
+  CHECK(isolate->GetHeapObjectStatisticsAtLastGC(&exact, SYMBOL_TYPE));
+  CHECK(isolate->GetSampledHeapObjectStatisticsAtLastGC(&stats, SYMBOL_TYPE));
+  CHECK_GE(exact.object_count(), 300000);
+  CHECK_GT(stats.object_count(), exact.object_count() / 2);
+  CHECK_LT(stats.object_count(), exact.object_count() * 3 / 2);
+  CHECK_GT(stats.object_size(), exact.object_size() / 2);
+  CHECK_LT(stats.object_size(), exact.object_size() * 3 / 2);
+  FLAG_gc_stats = 0;
+
+  FLAG_object_stats_sampling_rate = 0;
+  CHECK(!isolate->GetSampledHeapObjectStatisticsAtLastGC(&stats,
+                                                         BYTECODE_ARRAY_TYPE));
+}
+
+#ifdef ENABLE_MINOR_MC
+TEST(MinorMarkCompactSelectedThroughResourceConstraints) {
+  v8::Isolate::CreateParams create_params;
+  create_params.constraints.set_use_minor_mark_compact(true);
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate = v8::Isolate::New(create_params);
+  isolate->Enter();
+  {
+    Isolate* i_isolate = reinterpret_cast<Isolate*>(isolate);
+    Heap* heap = i_isolate->heap();
+    CHECK(heap->use_minor_mc());
+    CHECK_EQ(MINOR_MARK_COMPACTOR, heap->YoungGenerationCollector());
+    HandleScope handle_scope(i_isolate);
+    Handle<FixedArray> survivor = i_isolate->factory()->NewFixedArray(16);
+    CHECK(heap->InNewSpace(*survivor));
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+    heap->CollectGarbage(NEW_SPACE, GarbageCollectionReason::kTesting);
+    CHECK(heap->old_space()->Contains(*survivor));
+  }
+  isolate->Exit();
+  isolate->Dispose();
+}
+#endif  // ENABLE_MINOR_MC
+
+TEST(ConcurrentRememberedSetCompaction) {
+  FLAG_concurrent_remembered_set_compaction = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  Heap* heap = isolate->heap();
+  HandleScope scope(isolate);
+  const int kLength = 256;
+  Handle<FixedArray> old = isolate->factory()->NewFixedArray(kLength, TENURED);
+  CHECK(heap->old_space()->Contains(*old));
+
+  // Alternate between runtime stores and scavenges so that buckets are
+  // emptied and refilled while the background task may be running.
+  for (int round = 0; round < 8; round++) {
+    for (int i = 0; i < kLength; i++) {
+      Handle<HeapNumber> number =
+          isolate->factory()->NewHeapNumber(round * kLength + i);
+      CHECK(heap->InNewSpace(*number));
+      old->set(i, *number);
+    }
+    CcTest::CollectGarbage(NEW_SPACE);
+    for (int i = 0; i < kLength; i++) {
+      CHECK_EQ(round * kLength + i, old->get(i)->Number());
+    }
+  }
+
+  CcTest::CollectGarbage(NEW_SPACE);
+  Handle<HeapNumber> number = isolate->factory()->NewHeapNumber(42);
+  old->set(0, *number);
+  CHECK(heap->HasRecordedSlot(*old, old->RawFieldOfElementAt(0)));
+  CcTest::CollectGarbage(NEW_SPACE);
+  CHECK_EQ(42, old->get(0)->Number());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -483,5 +483,62 @@ TEST(GCFromWeakCallbacks) {
   }
 }
 
+namespace {
+
+class CountingRootVisitor : public RootVisitor {
+ public:
+  CountingRootVisitor() : count_(0) {}
+
+  void VisitRootPointers(Root root, const char* description, Object** start,
+                         Object** end) override {
+    count_ += end - start;
+  }
+
+  size_t count() const { return count_; }
+
+ private:
+  size_t count_;
+};
+
+}  // namespace
+
+TEST(StrongRootsInParallelMarking) {
+  FLAG_parallel_root_marking = true;
+  CcTest::InitializeVM();
+  Isolate* isolate = CcTest::i_isolate();
+  GlobalHandles* global_handles = isolate->global_handles();
+
+  // Spread the handles over multiple node blocks.
+  const int kHandles = 10 * 256 + 1;
+  std::vector<Handle<Object>> handles;
+  {
+    HandleScope scope(isolate);
+    for (int i = 0; i < kHandles; i++) {
+      handles.push_back(
+          global_handles->Create(*isolate->factory()->NewFixedArray(1)));
+    }
+  }
+
+  // Iterating the blocks in ranges visits every strong root exactly once.
+  CountingRootVisitor all;
+  global_handles->IterateStrongRoots(&all);
+  std::vector<GlobalHandles::UsedNodeBlockRange> ranges =
+      global_handles->PartitionUsedNodeBlocks(3);
+  CHECK_LE(4, ranges.size());
+  CountingRootVisitor ranged;
+  for (const GlobalHandles::UsedNodeBlockRange& range : ranges) {
+    CHECK_LE(range.count, 3);
+    global_handles->IterateStrongRoots(&ranged, range);
+  }
+  CHECK_EQ(all.count(), ranged.count());
+
+  // Objects only held by global handles survive a full GC.
+  CcTest::CollectAllGarbage();
+  for (Handle<Object> handle : handles) {
+    CHECK(handle->IsFixedArray());
+    GlobalHandles::Destroy(handle.location());
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -1124,6 +1124,135 @@ TEST(HeapSnapshotJSONSerializationAborting) {
 
 namespace {
 
+class BinarySnapshotReader {
+ public:
+  explicit BinarySnapshotReader(i::Vector<char> data) : data_(data), pos_(0) {}
+  uint64_t Varint() {
+    uint64_t result = 0;
+    for (int shift = 0;; shift += 7) {
+      CHECK_LT(pos_, data_.length());
+      uint8_t byte = static_cast<uint8_t>(data_[pos_++]);
+      result |= static_cast<uint64_t>(byte & 0x7F) << shift;
+      if (byte < 0x80) return result;
+    }
+  }
+  int64_t SignedVarint() {
+    uint64_t value = Varint();
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+  }
+  std::string Bytes(int length) {
+    CHECK_LE(pos_ + length, data_.length());
+    std::string result(data_.start() + pos_, length);
+    pos_ += length;
+    return result;
+  }
+  bool AtEnd() const { return pos_ == data_.length(); }
+
+ private:
+  i::Vector<char> data_;
+  int pos_;
+};
+
+}  // namespace
+
+TEST(HeapSnapshotBinarySerialization) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  CompileRun(
+      "function A(s) { this.s = s; }\n"
+      "var a = new A('String \\u0101\\u8001');");
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+
+  TestJSONStream stream;
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_EQ(1, stream.eos_signaled());
+  i::ScopedVector<char> binary(stream.size());
+  stream.WriteTo(binary);
+
+  TestJSONStream json_stream;
+  snapshot->Serialize(&json_stream, v8::HeapSnapshot::kJSON);
+  CHECK_LT(stream.size(), json_stream.size());
+
+  BinarySnapshotReader reader(binary);
+  CHECK_EQ(0, strncmp(binary.start(), "V8HS", 4));
+  reader.Bytes(4);
+  CHECK_EQ(1u, reader.Varint());
+  int node_count = static_cast<int>(reader.Varint());
+  CHECK_EQ(snapshot->GetNodesCount(), node_count);
+  uint64_t edge_count = reader.Varint();
+  uint64_t sample_count = reader.Varint();
+
+  std::vector<uint64_t> name_ids(node_count);
+  int64_t id = 0;
+  uint64_t total_edges = 0;
+  for (int i = 0; i < node_count; ++i) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    CHECK_EQ(static_cast<uint64_t>(node->GetType()), reader.Varint());
+    name_ids[i] = reader.Varint();
+    id += reader.SignedVarint();
+    CHECK_EQ(static_cast<int64_t>(node->GetId()), id);
+    CHECK_EQ(static_cast<uint64_t>(node->GetShallowSize()), reader.Varint());
+    uint64_t children = reader.Varint();
+    CHECK_EQ(static_cast<uint64_t>(node->GetChildrenCount()), children);
+    total_edges += children;
+    reader.Varint();  // trace_node_id
+  }
+  CHECK_EQ(total_edges, edge_count);
+
+  for (int i = 0; i < node_count; ++i) {
+    const v8::HeapGraphNode* node = snapshot->GetNode(i);
+    for (int j = 0; j < node->GetChildrenCount(); ++j) {
+      const v8::HeapGraphEdge* edge = node->GetChild(j);
+      CHECK_EQ(static_cast<uint64_t>(edge->GetType()), reader.Varint());
+      reader.Varint();  // name_or_index
+      uint64_t to_index = reader.Varint();
+      CHECK_LT(to_index, static_cast<uint64_t>(node_count));
+      CHECK_EQ(edge->GetToNode()->GetId(),
+               snapshot->GetNode(static_cast<int>(to_index))->GetId());
+    }
+  }
+
+  for (uint64_t i = 0; i < sample_count; ++i) {
+    reader.Varint();
+    reader.Varint();
+  }
+
+  std::vector<std::string> strings(1);
+  uint64_t string_count = reader.Varint();
+  for (uint64_t i = 0; i < string_count; ++i) {
+    strings.push_back(reader.Bytes(static_cast<int>(reader.Varint())));
+  }
+  CHECK(reader.AtEnd());
+
+  bool found_string = false;
+  for (int i = 0; i < node_count; ++i) {
+    CHECK_LT(name_ids[i], strings.size());
+    v8::String::Utf8Value name(env->GetIsolate(),
+                               snapshot->GetNode(i)->GetName());
+    CHECK_EQ(std::string(*name), strings[name_ids[i]]);
+    if (strings[name_ids[i]] == "String \xC4\x81\xE8\x80\x81") {
+      found_string = true;
+    }
+  }
+  CHECK(found_string);
+}
+
+TEST(HeapSnapshotBinarySerializationAborting) {
+  LocalContext env;
+  v8::HandleScope scope(env->GetIsolate());
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+  const v8::HeapSnapshot* snapshot = heap_profiler->TakeHeapSnapshot();
+  CHECK(ValidateSnapshot(snapshot));
+  TestJSONStream stream(5);
+  snapshot->Serialize(&stream, v8::HeapSnapshot::kBinary);
+  CHECK_GT(stream.size(), 0);
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
+namespace {
+
 class TestStatsStream : public v8::OutputStream {
  public:
   TestStatsStream()
@@ -3571,6 +3700,77 @@ TEST(SamplingHeapProfilerSampleDuringDeopt) {
   heap_profiler->StopSamplingHeapProfiler();
 }
 
+TEST(SamplingHeapProfilerSampleAge) {
+  v8::HandleScope scope(v8::Isolate::GetCurrent());
+  LocalContext env;
+  v8::HeapProfiler* heap_profiler = env->GetIsolate()->GetHeapProfiler();
+
+  // Turn off always_opt. Inlining can cause stack traces to be shorter than
+  // what we expect in this test.
+  v8::internal::FLAG_always_opt = false;
+
+  // Suppress randomness to avoid flakiness in tests.
+  v8::internal::FLAG_sampling_heap_profiler_suppress_randomness = true;
+
+  heap_profiler->StartSamplingHeapProfiler(1024);
+  CompileRun(
+      "var retained = [];\n"
+      "function allocateOld() {\n"
+      "  for (var i = 0; i < 64; ++i) retained.push(new Array(1024));\n"
+      "}\n"
+      "function allocateNew() {\n"
+      "  for (var i = 0; i < 64; ++i) retained.push(new Array(1024));\n"
+      "}\n"
+      "allocateOld();");
+  CcTest::CollectAllGarbage();
+  CcTest::CollectAllGarbage();
+  CompileRun("allocateNew();");
+
+  const char* old_names[] = {"", "allocateOld"};
+  const char* new_names[] = {"", "allocateNew"};
+
+  // Without an age limit both allocation sites are present.
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile(0));
+    CHECK(profile);
+    auto node_old = FindAllocationProfileNode(env->GetIsolate(), *profile,
+                                              ArrayVector(old_names));
+    auto node_new = FindAllocationProfileNode(env->GetIsolate(), *profile,
+                                              ArrayVector(new_names));
+    CHECK(node_old);
+    CHECK(node_new);
+    CHECK_GT(NumberOfAllocations(node_old), 0);
+    CHECK_GT(NumberOfAllocations(node_new), 0);
+    CHECK(!profile->GetSamples().empty());
+  }
+
+  // Only the samples that survived both GCs are counted.
+  {
+    std::unique_ptr<v8::AllocationProfile> profile(
+        heap_profiler->GetAllocationProfile(2));
+    CHECK(profile);
+    auto node_old = FindAllocationProfileNode(env->GetIsolate(), *profile,
+                                              ArrayVector(old_names));
+    auto node_new = FindAllocationProfileNode(env->GetIsolate(), *profile,
+                                              ArrayVector(new_names));
+    CHECK(node_old);
+    CHECK_GT(NumberOfAllocations(node_old), 0);
+    if (node_new) CHECK_EQ(0, NumberOfAllocations(node_new));
+
+    bool found_old_sample = false;
+    for (const v8::AllocationProfile::Sample& sample : profile->GetSamples()) {
+      CHECK_GE(sample.gcs_survived, 2u);
+      CHECK_NE(node_new, sample.node);
+      CHECK_GT(sample.allocation_time_ms, 0);
+      if (sample.node == node_old) found_old_sample = true;
+    }
+    CHECK(found_old_sample);
+  }
+
+  heap_profiler->StopSamplingHeapProfiler();
+}
+
 TEST(WeakReference) {
   v8::Isolate* isolate = CcTest::isolate();
   i::Isolate* i_isolate = CcTest::i_isolate();
@@ -2156,6 +2156,102 @@ TEST(CodeSerializerAfterExecute) {
   FLAG_opt = prev_opt_value;
 }
 
+namespace {
+
+FeedbackVector* GetFeedbackVector(v8::Local<v8::Context> context,
+                                  const char* name) {
+  Handle<JSFunction> function =
+      Handle<JSFunction>::cast(v8::Utils::OpenHandle(
+          *v8::Local<v8::Function>::Cast(context->Global()
+                                             ->Get(context, v8_str(name))
+                                             .ToLocalChecked())));
+  return function->feedback_vector();
+}
+
+FeedbackSlot GetLiteralSlot(FeedbackVector* vector) {
+  FeedbackMetadataIterator slots(vector->metadata());
+  while (slots.HasNext()) {
+    FeedbackSlot slot = slots.Next();
+    if (slots.kind() == FeedbackSlotKind::kLiteral) return slot;
+  }
+  UNREACHABLE();
+}
+
+AllocationSite* GetLiteralSite(v8::Local<v8::Context> context,
+                               const char* name) {
+  FeedbackVector* vector = GetFeedbackVector(context, name);
+  return AllocationSite::cast(vector->Get(GetLiteralSlot(vector)));
+}
+
+bool HasLiteralPretenuringHint(v8::Local<v8::Context> context,
+                               const char* name) {
+  FeedbackVector* vector = GetFeedbackVector(context, name);
+  return vector->metadata()->HasPretenuringHint(GetLiteralSlot(vector));
+}
+
+}  // namespace
+
+TEST(CodeSerializerPretenuringHints) {
+  if (!FLAG_allocation_site_pretenuring || !FLAG_opt) return;
+  FLAG_allow_natives_syntax = true;
+  const char* source = "function f() { return [[1, 2], [3]]; }; f();";
+  v8::ScriptCompiler::CachedData* cache;
+
+  v8::Isolate::CreateParams create_params;
+  create_params.array_buffer_allocator = CcTest::array_buffer_allocator();
+  v8::Isolate* isolate1 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate1);
+    v8::HandleScope scope(isolate1);
+    v8::Local<v8::Context> context = v8::Context::New(isolate1);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(isolate1, &source_obj)
+            .ToLocalChecked();
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+    // Pretend that the literal in f was found to be long-lived. The hint is
+    // recorded when f is optimized.
+    GetLiteralSite(context, "f")->set_pretenure_decision(
+        AllocationSite::kTenure);
+    CHECK(!HasLiteralPretenuringHint(context, "f"));
+    CompileRun("%OptimizeFunctionOnNextCall(f); f();");
+    CHECK(HasLiteralPretenuringHint(context, "f"));
+    cache = ScriptCompiler::CreateCodeCache(script);
+    CHECK(cache);
+  }
+  isolate1->Dispose();
+
+  v8::Isolate* isolate2 = v8::Isolate::New(create_params);
+  {
+    v8::Isolate::Scope iscope(isolate2);
+    v8::HandleScope scope(isolate2);
+    v8::Local<v8::Context> context = v8::Context::New(isolate2);
+    v8::Context::Scope context_scope(context);
+
+    v8::ScriptOrigin origin(v8_str("test"));
+    v8::ScriptCompiler::Source source_obj(v8_str(source), origin, cache);
+    v8::Local<v8::UnboundScript> script =
+        v8::ScriptCompiler::CompileUnboundScript(
+            isolate2, &source_obj, v8::ScriptCompiler::kConsumeCodeCache)
+            .ToLocalChecked();
+    CHECK(!cache->rejected);
+    script->BindToCurrentContext()->Run(context).ToLocalChecked();
+
+    // The site created in the new isolate starts out tenured.
+    AllocationSite* site = GetLiteralSite(context, "f");
+    CHECK_EQ(TENURED, site->GetPretenureMode());
+    CHECK(!reinterpret_cast<Isolate*>(isolate2)->heap()->InNewSpace(
+        site->boilerplate()));
+    // The hint has been consumed by the site.
+    CHECK(!HasLiteralPretenuringHint(context, "f"));
+  }
+  isolate2->Dispose();
+  delete cache;
+}
+
 TEST(CodeSerializerFlagChange) {
   const char* source = "function f() { return 'abc'; }; f() + 'def'";
   v8::ScriptCompiler::CachedData* cache = CompileRunAndProduceCache(source);
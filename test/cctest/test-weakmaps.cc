@@ -244,6 +244,81 @@ TEST(Regress399527) {
   CcTest::CollectAllGarbage();
 }
 
+// Builds a chain key -> object_1 -> ... -> object_n -> Smi of entries in a
+// weak map where only the first key is reachable, plus a chain of the same
+// length that is unreachable, and checks that a full GC keeps exactly the
+// reachable chain.
+static void CheckEphemeronChain(int chain_length) {
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = factory->NewJSWeakMap();
+  Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  Handle<JSObject> live_key = factory->NewJSObjectFromMap(map);
+  {
+    HandleScope scope(isolate);
+    Handle<JSObject> live = live_key;
+    Handle<JSObject> dead = factory->NewJSObjectFromMap(map);
+    for (int i = 0; i < chain_length; i++) {
+      Handle<JSObject> next_live = factory->NewJSObjectFromMap(map);
+      Handle<JSObject> next_dead = factory->NewJSObjectFromMap(map);
+      JSWeakCollection::Set(weakmap, live, next_live,
+                            live->GetOrCreateHash(isolate)->value());
+      JSWeakCollection::Set(weakmap, dead, next_dead,
+                            dead->GetOrCreateHash(isolate)->value());
+      live = next_live;
+      dead = next_dead;
+    }
+    Handle<Smi> smi(Smi::FromInt(42), isolate);
+    JSWeakCollection::Set(weakmap, live, smi,
+                          live->GetOrCreateHash(isolate)->value());
+  }
+  CHECK_EQ(2 * chain_length + 1,
+           ObjectHashTable::cast(weakmap->table())->NumberOfElements());
+
+  CcTest::CollectAllGarbage(Heap::kAbortIncrementalMarkingMask);
+  CHECK_EQ(chain_length + 1,
+           ObjectHashTable::cast(weakmap->table())->NumberOfElements());
+}
+
+TEST(EphemeronChainFixpoint) {
+  FLAG_incremental_marking = false;
+  FLAG_ephemeron_fixpoint_iterations = 1000;
+  CheckEphemeronChain(100);
+}
+
+TEST(EphemeronChainLinear) {
+  FLAG_incremental_marking = false;
+  FLAG_ephemeron_fixpoint_iterations = 0;
+  CheckEphemeronChain(100);
+}
+
+TEST(EphemeronChainIncremental) {
+  if (!FLAG_incremental_marking) return;
+  FLAG_concurrent_weak_collection_marking = true;
+  LocalContext context;
+  Isolate* isolate = GetIsolateFrom(&context);
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<JSWeakMap> weakmap = factory->NewJSWeakMap();
+  Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  Handle<JSObject> key = factory->NewJSObjectFromMap(map);
+  {
+    HandleScope scope(isolate);
+    Handle<JSObject> value = factory->NewJSObjectFromMap(map);
+    Handle<JSObject> dead_key = factory->NewJSObjectFromMap(map);
+    JSWeakCollection::Set(weakmap, key, value,
+                          key->GetOrCreateHash(isolate)->value());
+    JSWeakCollection::Set(weakmap, dead_key, value,
+                          dead_key->GetOrCreateHash(isolate)->value());
+  }
+  heap::SimulateIncrementalMarking(isolate->heap());
+  CcTest::CollectAllGarbage();
+  CHECK_EQ(1, ObjectHashTable::cast(weakmap->table())->NumberOfElements());
+  CHECK(weakmap->next()->IsUndefined(isolate));
+}
+
 }  // namespace test_weakmaps
 }  // namespace internal
 }  // namespace v8
@@ -40,7 +40,7 @@ namespace compiler {
 class Types {
  public:
   Types(Zone* zone, Isolate* isolate, v8::base::RandomNumberGenerator* rng)
-      : zone_(zone), rng_(rng) {
+      : zone_(zone), js_heap_broker_(isolate, zone), rng_(rng) {
 #define DECLARE_TYPE(name, value) \
   name = Type::name();            \
   types.push_back(name);
@@ -65,13 +65,14 @@ class Types {
     object2 = isolate->factory()->NewJSObjectFromMap(object_map);
     array = isolate->factory()->NewJSArray(20);
     uninitialized = isolate->factory()->uninitialized_value();
-    SmiConstant = Type::NewConstant(smi, zone);
-    Signed32Constant = Type::NewConstant(signed32, zone);
+    SmiConstant = Type::NewConstant(&js_heap_broker_, smi, zone);
+    Signed32Constant = Type::NewConstant(&js_heap_broker_, signed32, zone);
 
-    ObjectConstant1 = Type::HeapConstant(object1, zone);
-    ObjectConstant2 = Type::HeapConstant(object2, zone);
-    ArrayConstant = Type::HeapConstant(array, zone);
-    UninitializedConstant = Type::HeapConstant(uninitialized, zone);
+    ObjectConstant1 = Type::HeapConstant(&js_heap_broker_, object1, zone);
+    ObjectConstant2 = Type::HeapConstant(&js_heap_broker_, object2, zone);
+    ArrayConstant = Type::HeapConstant(&js_heap_broker_, array, zone);
+    UninitializedConstant =
+        Type::HeapConstant(&js_heap_broker_, uninitialized, zone);
 
     values.push_back(smi);
     values.push_back(boxed_smi);
@@ -84,7 +85,7 @@ class Types {
     values.push_back(float2);
     values.push_back(float3);
     for (ValueVector::iterator it = values.begin(); it != values.end(); ++it) {
-      types.push_back(Type::NewConstant(*it, zone));
+      types.push_back(Type::NewConstant(&js_heap_broker_, *it, zone));
     }
 
     integers.push_back(isolate->factory()->NewNumber(-V8_INFINITY));
@@ -144,11 +145,11 @@ class Types {
   Type* Of(Handle<i::Object> value) { return Type::Of(value, zone_); }
 
   Type* NewConstant(Handle<i::Object> value) {
-    return Type::NewConstant(value, zone_);
+    return Type::NewConstant(&js_heap_broker_, value, zone_);
   }
 
   Type* HeapConstant(Handle<i::HeapObject> value) {
-    return Type::HeapConstant(value, zone_);
+    return Type::HeapConstant(&js_heap_broker_, value, zone_);
   }
 
   Type* Range(double min, double max) { return Type::Range(min, max, zone_); }
@@ -188,7 +189,7 @@ class Types {
       }
       case 1: {  // constant
         int i = rng_->NextInt(static_cast<int>(values.size()));
-        return Type::NewConstant(values[i], zone_);
+        return Type::NewConstant(&js_heap_broker_, values[i], zone_);
       }
       case 2: {  // range
         int i = rng_->NextInt(static_cast<int>(integers.size()));
@@ -215,6 +216,7 @@ class Types {
 
  private:
   Zone* zone_;
+  JSHeapBroker js_heap_broker_;
   v8::base::RandomNumberGenerator* rng_;
 };
 
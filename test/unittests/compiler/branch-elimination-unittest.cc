@@ -6,6 +6,7 @@
 #include "src/compiler/js-graph.h"
 #include "src/compiler/linkage.h"
 #include "src/compiler/node-properties.h"
+#include "src/compiler/simplified-operator.h"
 #include "test/unittests/compiler/compiler-test-utils.h"
 #include "test/unittests/compiler/graph-unittest.h"
 #include "test/unittests/compiler/node-test-utils.h"
@@ -18,10 +19,39 @@ namespace compiler {
 class BranchEliminationTest : public GraphTest {
  public:
   BranchEliminationTest()
-      : machine_(zone(), MachineType::PointerRepresentation(),
-                 MachineOperatorBuilder::kNoFlags) {}
+      : GraphTest(2),
+        machine_(zone(), MachineType::PointerRepresentation(),
+                 MachineOperatorBuilder::kNoFlags),
+        simplified_(zone()) {}
 
   MachineOperatorBuilder* machine() { return &machine_; }
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+
+  // Builds {if (index < length) return CheckBounds(index, length);} and
+  // returns the value input of the return.
+  Node* CheckBoundsInBranch(Type* index_type, bool on_true_branch) {
+    Node* index = Parameter(0);
+    Node* length = Parameter(1);
+    NodeProperties::SetType(index, index_type);
+    NodeProperties::SetType(length, Type::Unsigned31());
+    Node* condition =
+        graph()->NewNode(simplified()->NumberLessThan(), index, length);
+    Node* branch =
+        graph()->NewNode(common()->Branch(), condition, graph()->start());
+    Node* if_true = graph()->NewNode(common()->IfTrue(), branch);
+    Node* if_false = graph()->NewNode(common()->IfFalse(), branch);
+    Node* control = on_true_branch ? if_true : if_false;
+    Node* check =
+        graph()->NewNode(simplified()->CheckBounds(VectorSlotPair()), index,
+                         length, graph()->start(), control);
+    Node* zero = graph()->NewNode(common()->Int32Constant(0));
+    Node* ret =
+        graph()->NewNode(common()->Return(), zero, check, check, control);
+    graph()->SetEnd(graph()->NewNode(common()->End(1), ret));
+
+    Reduce();
+    return NodeProperties::GetValueInput(ret, 1);
+  }
 
   void Reduce() {
     JSOperatorBuilder javascript(zone());
@@ -36,6 +66,7 @@ class BranchEliminationTest : public GraphTest {
 
  private:
   MachineOperatorBuilder machine_;
+  SimplifiedOperatorBuilder simplified_;
 };
 
 
@@ -208,6 +239,30 @@ TEST_F(BranchEliminationTest, BranchInsideLoopSame) {
   EXPECT_THAT(ret1, IsReturn(IsInt32Constant(2), effect, loop));
 }
 
+
+TEST_F(BranchEliminationTest, CheckBoundsDominatedByLessThan) {
+  Node* value = CheckBoundsInBranch(Type::Range(0.0, 100.0, zone()), true);
+  EXPECT_EQ(IrOpcode::kParameter, value->opcode());
+}
+
+
+TEST_F(BranchEliminationTest, CheckBoundsOnFalseBranch) {
+  Node* value = CheckBoundsInBranch(Type::Range(0.0, 100.0, zone()), false);
+  EXPECT_EQ(IrOpcode::kCheckBounds, value->opcode());
+}
+
+
+TEST_F(BranchEliminationTest, CheckBoundsWithNegativeIndex) {
+  Node* value = CheckBoundsInBranch(Type::Range(-1.0, 100.0, zone()), true);
+  EXPECT_EQ(IrOpcode::kCheckBounds, value->opcode());
+}
+
+
+TEST_F(BranchEliminationTest, CheckBoundsWithFractionalIndex) {
+  Node* value = CheckBoundsInBranch(Type::OrderedNumber(), true);
+  EXPECT_EQ(IrOpcode::kCheckBounds, value->opcode());
+}
+
 }  // namespace compiler
 }  // namespace internal
 }  // namespace v8
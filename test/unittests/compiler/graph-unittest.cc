@@ -18,6 +18,7 @@ GraphTest::GraphTest(int num_parameters)
       TestWithIsolateAndZone(),
       common_(zone()),
       graph_(zone()),
+      js_heap_broker_(isolate(), zone()),
       source_positions_(&graph_) {
   graph()->SetStart(graph()->NewNode(common()->Start(num_parameters)));
   graph()->SetEnd(graph()->NewNode(common()->End(1), graph()->start()));
@@ -59,7 +60,7 @@ Node* GraphTest::NumberConstant(volatile double value) {
 
 Node* GraphTest::HeapConstant(const Handle<HeapObject>& value) {
   Node* node = graph()->NewNode(common()->HeapConstant(value));
-  Type* type = Type::NewConstant(value, zone());
+  Type* type = Type::NewConstant(js_heap_broker(), value, zone());
   NodeProperties::SetType(node, type);
   return node;
 }
@@ -109,7 +110,8 @@ Matcher<Node*> GraphTest::IsUndefinedConstant() {
 }
 
 TypedGraphTest::TypedGraphTest(int num_parameters)
-    : GraphTest(num_parameters), typer_(isolate(), Typer::kNoFlags, graph()) {}
+    : GraphTest(num_parameters),
+      typer_(isolate(), js_heap_broker(), Typer::kNoFlags, graph()) {}
 
 TypedGraphTest::~TypedGraphTest() {}
 
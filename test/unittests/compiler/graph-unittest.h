@@ -8,6 +8,7 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/compiler-source-position-table.h"
 #include "src/compiler/graph.h"
+#include "src/compiler/js-heap-broker.h"
 #include "src/compiler/typer.h"
 #include "test/unittests/test-utils.h"
 #include "testing/gmock/include/gmock/gmock.h"
@@ -60,10 +61,12 @@ class GraphTest : public virtual TestWithNativeContext,
   CommonOperatorBuilder* common() { return &common_; }
   Graph* graph() { return &graph_; }
   SourcePositionTable* source_positions() { return &source_positions_; }
+  JSHeapBroker* js_heap_broker() { return &js_heap_broker_; }
 
  private:
   CommonOperatorBuilder common_;
   Graph graph_;
+  JSHeapBroker js_heap_broker_;
   SourcePositionTable source_positions_;
 };
 
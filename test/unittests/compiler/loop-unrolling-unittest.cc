@@ -0,0 +1,189 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/graph.h"
+#include "src/compiler/graph-visualizer.h"
+#include "src/compiler/loop-analysis.h"
+#include "src/compiler/loop-unrolling.h"
+#include "src/compiler/machine-operator.h"
+#include "src/compiler/node.h"
+#include "src/compiler/node-properties.h"
+#include "test/unittests/compiler/graph-unittest.h"
+#include "test/unittests/compiler/node-test-utils.h"
+#include "testing/gmock-support.h"
+
+using testing::_;
+using testing::AllOf;
+using testing::Capture;
+using testing::CaptureEq;
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+struct While {
+  Node* loop;
+  Node* branch;
+  Node* if_true;
+  Node* if_false;
+  Node* exit;
+};
+
+
+// A helper for building counters attached to loops.
+struct Counter {
+  Node* base;
+  Node* inc;
+  Node* phi;
+  Node* add;
+  Node* exit_marker;
+};
+
+}  // namespace
+
+
+class LoopUnrollingTest : public GraphTest {
+ public:
+  LoopUnrollingTest() : GraphTest(1), machine_(zone()) {}
+  ~LoopUnrollingTest() override {}
+
+ protected:
+  MachineOperatorBuilder machine_;
+
+  MachineOperatorBuilder* machine() { return &machine_; }
+
+  LoopTree* GetLoopTree() {
+    if (FLAG_trace_turbo_graph) {
+      OFStream os(stdout);
+      os << AsRPO(*graph());
+    }
+    Zone zone(isolate()->allocator(), ZONE_NAME);
+    return LoopFinder::BuildLoopTree(graph(), &zone);
+  }
+
+  void UnrollOne(int unroll_count) {
+    LoopTree* loop_tree = GetLoopTree();
+    LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+    LoopUnroller unroller(graph(), common(), loop_tree, zone(),
+                          source_positions());
+    EXPECT_TRUE(unroller.CanUnroll(loop));
+    unroller.Unroll(loop, unroll_count);
+    if (FLAG_trace_turbo_graph) {
+      OFStream os(stdout);
+      os << AsRPO(*graph());
+    }
+  }
+
+  Node* InsertReturn(Node* val, Node* effect, Node* control) {
+    Node* zero = graph()->NewNode(common()->Int32Constant(0));
+    Node* r = graph()->NewNode(common()->Return(), zero, val, effect, control);
+    graph()->SetEnd(r);
+    return r;
+  }
+
+  While NewWhile(Node* cond, Node* control = nullptr) {
+    if (control == nullptr) control = start();
+    While w;
+    w.loop = graph()->NewNode(common()->Loop(2), control, control);
+    w.branch = graph()->NewNode(common()->Branch(), cond, w.loop);
+    w.if_true = graph()->NewNode(common()->IfTrue(), w.branch);
+    w.if_false = graph()->NewNode(common()->IfFalse(), w.branch);
+    w.exit = graph()->NewNode(common()->LoopExit(), w.if_false, w.loop);
+    w.loop->ReplaceInput(1, w.if_true);
+    return w;
+  }
+
+  void Nest(While* a, While* b) {
+    b->loop->ReplaceInput(1, a->exit);
+    a->loop->ReplaceInput(0, b->if_true);
+  }
+
+  Counter NewCounter(While* w, int32_t b, int32_t k) {
+    Counter c;
+    c.base = Int32Constant(b);
+    c.inc = Int32Constant(k);
+    c.phi = graph()->NewNode(common()->Phi(MachineRepresentation::kTagged, 2),
+                             c.base, c.base, w->loop);
+    c.add = graph()->NewNode(machine()->Int32Add(), c.phi, c.inc);
+    c.phi->ReplaceInput(1, c.add);
+    c.exit_marker = graph()->NewNode(common()->LoopExitValue(), c.phi, w->exit);
+    return c;
+  }
+};
+
+
+TEST_F(LoopUnrollingTest, SimpleLoop) {
+  Node* p0 = Parameter(0);
+  While w = NewWhile(p0);
+  Node* r = InsertReturn(p0, start(), w.exit);
+
+  UnrollOne(2);
+
+  Capture<Node*> branch1;
+  EXPECT_THAT(w.loop,
+              IsLoop(start(), IsIfTrue(AllOf(CaptureEq(&branch1),
+                                             IsBranch(p0, w.if_true)))));
+  Node* merge = NodeProperties::GetControlInput(r);
+  EXPECT_THAT(merge, IsMerge(w.exit, _));
+  Node* exit1 = merge->InputAt(1);
+  EXPECT_EQ(IrOpcode::kLoopExit, exit1->opcode());
+  EXPECT_THAT(exit1->InputAt(0), IsIfFalse(branch1.value()));
+  EXPECT_EQ(w.loop, exit1->InputAt(1));
+}
+
+
+TEST_F(LoopUnrollingTest, SimpleLoopWithCounter) {
+  Node* p0 = Parameter(0);
+  While w = NewWhile(p0);
+  Counter c = NewCounter(&w, 0, 1);
+  Node* r = InsertReturn(c.exit_marker, start(), w.exit);
+
+  UnrollOne(2);
+
+  // The second iteration starts from the increment of the first one.
+  EXPECT_THAT(c.phi, IsPhi(MachineRepresentation::kTagged, c.base,
+                           IsInt32Add(c.add, c.inc), w.loop));
+  Node* merge = NodeProperties::GetControlInput(r);
+  EXPECT_THAT(merge, IsMerge(w.exit, _));
+  Node* phi = NodeProperties::GetValueInput(r, 1);
+  EXPECT_THAT(phi, IsPhi(MachineRepresentation::kTagged, c.exit_marker, _,
+                         merge));
+  Node* exit_marker1 = phi->InputAt(1);
+  EXPECT_EQ(IrOpcode::kLoopExitValue, exit_marker1->opcode());
+  EXPECT_EQ(c.add, exit_marker1->InputAt(0));
+  EXPECT_EQ(merge->InputAt(1), exit_marker1->InputAt(1));
+}
+
+
+TEST_F(LoopUnrollingTest, OnlyInnermostLoops) {
+  Node* p0 = Parameter(0);
+  While outer = NewWhile(p0);
+  While inner = NewWhile(p0);
+  Nest(&inner, &outer);
+  InsertReturn(p0, start(), outer.exit);
+
+  LoopTree* loop_tree = GetLoopTree();
+  LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+  LoopUnroller unroller(graph(), common(), loop_tree, zone(),
+                        source_positions());
+  EXPECT_FALSE(unroller.CanUnroll(loop));
+  EXPECT_TRUE(unroller.CanUnroll(loop->children()[0]));
+}
+
+
+TEST_F(LoopUnrollingTest, UnrollCountFor) {
+  Node* p0 = Parameter(0);
+  While w = NewWhile(p0);
+  InsertReturn(p0, start(), w.exit);
+
+  LoopTree* loop_tree = GetLoopTree();
+  LoopTree::Loop* loop = loop_tree->outer_loops()[0];
+  EXPECT_EQ(LoopUnroller::kMaxUnrollCount, LoopUnroller::UnrollCountFor(loop));
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
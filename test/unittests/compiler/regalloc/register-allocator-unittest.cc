@@ -83,6 +83,26 @@ class RegisterAllocatorTest : public InstructionSequenceTest {
   }
 };
 
+class SecondChanceAllocationTest : public RegisterAllocatorTest {
+ public:
+  SecondChanceAllocationTest()
+      : old_enabled_(FLAG_turbo_second_chance_allocation),
+        old_min_instructions_(
+            FLAG_turbo_second_chance_allocation_min_instructions) {
+    FLAG_turbo_second_chance_allocation = true;
+    FLAG_turbo_second_chance_allocation_min_instructions = 0;
+  }
+  ~SecondChanceAllocationTest() override {
+    FLAG_turbo_second_chance_allocation = old_enabled_;
+    FLAG_turbo_second_chance_allocation_min_instructions =
+        old_min_instructions_;
+  }
+
+ private:
+  bool old_enabled_;
+  int old_min_instructions_;
+};
+
 TEST_F(RegisterAllocatorTest, CanAllocateThreeRegisters) {
   // return p0 + p1;
   StartBlock();
@@ -593,6 +613,58 @@ TEST_F(RegisterAllocatorTest, DiamondWithCallSecondBlock) {
   Allocate();
 }
 
+TEST_F(SecondChanceAllocationTest, ValuesLiveAcrossCall) {
+  StartBlock();
+  VReg values[kDefaultNRegs];
+  for (size_t i = 0; i < arraysize(values); ++i) {
+    values[i] = Define(Reg());
+  }
+  EmitCall(Slot(-1));
+  for (size_t i = 0; i < arraysize(values); ++i) {
+    EmitI(Use(values[i]));
+  }
+  for (size_t i = 0; i < arraysize(values); ++i) {
+    EmitI(Reg(values[i]));
+  }
+  Return(Reg(values[0]));
+  EndBlock(Last());
+
+  Allocate();
+}
+
+TEST_F(SecondChanceAllocationTest, PressureDropsAfterSpill) {
+  const int kNumRegs = 3;
+  SetNumRegs(kNumRegs, kNumRegs);
+
+  StartBlock();
+  auto value = Define(Reg());
+  // Keep all registers busy, so that {value} gets spilled.
+  VReg temps[kNumRegs];
+  for (int i = 0; i < kNumRegs; ++i) {
+    temps[i] = Define(Reg());
+  }
+  for (int i = 0; i < kNumRegs; ++i) {
+    EmitI(Reg(temps[i]));
+  }
+  // From here on only {value} is live.
+  Instruction* first_use = EmitI(Use(value));
+  Instruction* second_use = EmitI(Use(value));
+  Instruction* ret = Return(Reg(value));
+  EndBlock(Last());
+
+  Allocate();
+
+  // {value} is reloaded before its first use once the pressure is gone, and
+  // stays in that register up to the return.
+  EXPECT_TRUE(first_use->InputAt(0)->IsRegister());
+  EXPECT_TRUE(second_use->InputAt(0)->IsRegister());
+  EXPECT_TRUE(first_use->InputAt(0)->Equals(*ret->InputAt(0)));
+  for (Instruction::GapPosition gap : {Instruction::START, Instruction::END}) {
+    const ParallelMove* moves = ret->GetParallelMove(gap);
+    if (moves != nullptr) EXPECT_EQ(0, GetMoveCount(*moves));
+  }
+}
+
 TEST_F(RegisterAllocatorTest, SingleDeferredBlockSpill) {
   StartBlock();  // B0
   auto var = EmitOI(Reg(0));
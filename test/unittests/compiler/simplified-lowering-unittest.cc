@@ -42,11 +42,12 @@ class SimplifiedLoweringTest : public GraphTest {
     {
       // Simplified lowering needs to run w/o the typer decorator so make sure
       // the object is not live at the same time.
-      Typer typer(isolate(), Typer::kNoFlags, graph());
+      Typer typer(isolate(), js_heap_broker(), Typer::kNoFlags, graph());
       typer.Run();
     }
 
-    SimplifiedLowering lowering(jsgraph(), zone(), source_positions());
+    SimplifiedLowering lowering(jsgraph(), js_heap_broker(), zone(),
+                                source_positions());
     lowering.LowerAllNodes();
   }
 
@@ -73,7 +73,8 @@ class TypedOptimizationTest : public TypedGraphTest {
                     &machine);
     // TODO(titzer): mock the GraphReducer here for better unit testing.
     GraphReducer graph_reducer(zone(), graph());
-    TypedOptimization reducer(&graph_reducer, &deps_, &jsgraph);
+    TypedOptimization reducer(&graph_reducer, &deps_, &jsgraph,
+                              js_heap_broker());
     return reducer.Reduce(node);
   }
 
@@ -86,8 +87,8 @@ class TypedOptimizationTest : public TypedGraphTest {
 
 TEST_F(TypedOptimizationTest, ParameterWithMinusZero) {
   {
-    Reduction r = Reduce(
-        Parameter(Type::NewConstant(factory()->minus_zero_value(), zone())));
+    Reduction r = Reduce(Parameter(Type::NewConstant(
+        js_heap_broker(), factory()->minus_zero_value(), zone())));
     ASSERT_TRUE(r.Changed());
     EXPECT_THAT(r.replacement(), IsNumberConstant(-0.0));
   }
@@ -98,7 +99,8 @@ TEST_F(TypedOptimizationTest, ParameterWithMinusZero) {
   }
   {
     Reduction r = Reduce(Parameter(Type::Union(
-        Type::MinusZero(), Type::NewConstant(factory()->NewNumber(0), zone()),
+        Type::MinusZero(),
+        Type::NewConstant(js_heap_broker(), factory()->NewNumber(0), zone()),
         zone())));
     EXPECT_FALSE(r.Changed());
   }
@@ -107,7 +109,8 @@ TEST_F(TypedOptimizationTest, ParameterWithMinusZero) {
 TEST_F(TypedOptimizationTest, ParameterWithNull) {
   Handle<HeapObject> null = factory()->null_value();
   {
-    Reduction r = Reduce(Parameter(Type::NewConstant(null, zone())));
+    Reduction r =
+        Reduce(Parameter(Type::NewConstant(js_heap_broker(), null, zone())));
     ASSERT_TRUE(r.Changed());
     EXPECT_THAT(r.replacement(), IsHeapConstant(null));
   }
@@ -124,13 +127,14 @@ TEST_F(TypedOptimizationTest, ParameterWithNaN) {
                           std::numeric_limits<double>::signaling_NaN()};
   TRACED_FOREACH(double, nan, kNaNs) {
     Handle<Object> constant = factory()->NewNumber(nan);
-    Reduction r = Reduce(Parameter(Type::NewConstant(constant, zone())));
+    Reduction r = Reduce(
+        Parameter(Type::NewConstant(js_heap_broker(), constant, zone())));
     ASSERT_TRUE(r.Changed());
     EXPECT_THAT(r.replacement(), IsNumberConstant(IsNaN()));
   }
   {
-    Reduction r =
-        Reduce(Parameter(Type::NewConstant(factory()->nan_value(), zone())));
+    Reduction r = Reduce(Parameter(
+        Type::NewConstant(js_heap_broker(), factory()->nan_value(), zone())));
     ASSERT_TRUE(r.Changed());
     EXPECT_THAT(r.replacement(), IsNumberConstant(IsNaN()));
   }
@@ -144,7 +148,8 @@ TEST_F(TypedOptimizationTest, ParameterWithNaN) {
 TEST_F(TypedOptimizationTest, ParameterWithPlainNumber) {
   TRACED_FOREACH(double, value, kFloat64Values) {
     Handle<Object> constant = factory()->NewNumber(value);
-    Reduction r = Reduce(Parameter(Type::NewConstant(constant, zone())));
+    Reduction r = Reduce(
+        Parameter(Type::NewConstant(js_heap_broker(), constant, zone())));
     ASSERT_TRUE(r.Changed());
     EXPECT_THAT(r.replacement(), IsNumberConstant(value));
   }
@@ -163,7 +168,8 @@ TEST_F(TypedOptimizationTest, ParameterWithUndefined) {
     EXPECT_THAT(r.replacement(), IsHeapConstant(undefined));
   }
   {
-    Reduction r = Reduce(Parameter(Type::NewConstant(undefined, zone())));
+    Reduction r = Reduce(
+        Parameter(Type::NewConstant(js_heap_broker(), undefined, zone())));
     ASSERT_TRUE(r.Changed());
     EXPECT_THAT(r.replacement(), IsHeapConstant(undefined));
   }
@@ -184,9 +190,11 @@ TEST_F(TypedOptimizationTest, ToBooleanWithFalsish) {
                       Type::Undefined(),
                       Type::Union(
                           Type::Undetectable(),
-                          Type::Union(Type::NewConstant(
-                                          factory()->false_value(), zone()),
-                                      Type::Range(0.0, 0.0, zone()), zone()),
+                          Type::Union(
+                              Type::NewConstant(js_heap_broker(),
+                                                factory()->false_value(),
+                                                zone()),
+                              Type::Range(0.0, 0.0, zone()), zone()),
                           zone()),
                       zone()),
                   zone()),
@@ -201,7 +209,7 @@ TEST_F(TypedOptimizationTest, ToBooleanWithFalsish) {
 TEST_F(TypedOptimizationTest, ToBooleanWithTruish) {
   Node* input = Parameter(
       Type::Union(
-          Type::NewConstant(factory()->true_value(), zone()),
+          Type::NewConstant(js_heap_broker(), factory()->true_value(), zone()),
           Type::Union(Type::DetectableReceiver(), Type::Symbol(), zone()),
           zone()),
       0);
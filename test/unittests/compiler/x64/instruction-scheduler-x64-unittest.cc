@@ -0,0 +1,90 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+#include "test/unittests/test-utils.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// The latencies the x64 scheduler used before it modeled several
+// microarchitectures.
+int GetPreviousLatency(ArchOpcode opcode) {
+  switch (opcode) {
+    case kSSEFloat64Mul:
+      return 5;
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64ImulHigh32:
+    case kX64UmulHigh32:
+    case kSSEFloat32Cmp:
+    case kSSEFloat32Add:
+    case kSSEFloat32Sub:
+    case kSSEFloat32Abs:
+    case kSSEFloat32Neg:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Max:
+    case kSSEFloat64Min:
+    case kSSEFloat64Abs:
+    case kSSEFloat64Neg:
+      return 3;
+    case kSSEFloat32Mul:
+    case kSSEFloat32ToFloat64:
+    case kSSEFloat64ToFloat32:
+    case kSSEFloat32Round:
+    case kSSEFloat64Round:
+    case kSSEFloat32ToInt32:
+    case kSSEFloat32ToUint32:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+      return 4;
+    case kX64Idiv:
+      return 49;
+    case kX64Idiv32:
+      return 35;
+    case kX64Udiv:
+      return 38;
+    case kX64Udiv32:
+      return 26;
+    case kSSEFloat32Div:
+    case kSSEFloat64Div:
+    case kSSEFloat32Sqrt:
+    case kSSEFloat64Sqrt:
+      return 13;
+    case kSSEFloat32ToInt64:
+    case kSSEFloat64ToInt64:
+    case kSSEFloat32ToUint64:
+    case kSSEFloat64ToUint64:
+      return 10;
+    case kSSEFloat64Mod:
+      return 50;
+    case kArchTruncateDoubleToI:
+      return 6;
+    default:
+      return 1;
+  }
+}
+
+}  // namespace
+
+typedef TestWithZone InstructionSchedulerX64Test;
+
+TEST_F(InstructionSchedulerX64Test, GenericLatenciesAreUnchanged) {
+  for (int i = 0; i <= kLastArchOpcode; i++) {
+    ArchOpcode opcode = static_cast<ArchOpcode>(i);
+    Instruction* instr = Instruction::New(zone(), opcode);
+    EXPECT_EQ(GetPreviousLatency(opcode),
+              InstructionScheduler::GetInstructionLatency(instr, false))
+        << opcode;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
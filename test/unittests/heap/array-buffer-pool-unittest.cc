@@ -0,0 +1,146 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string.h>
+
+#include "src/flags.h"
+#include "src/heap/array-buffer-pool.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+class CountingAllocator : public v8::ArrayBuffer::Allocator {
+ public:
+  CountingAllocator() : allocations_(0), frees_(0) {}
+
+  void* Allocate(size_t length) override {
+    allocations_++;
+    return calloc(length, 1);
+  }
+  void* AllocateUninitialized(size_t length) override {
+    allocations_++;
+    return malloc(length);
+  }
+  void Free(void* data, size_t length) override {
+    frees_++;
+    free(data);
+  }
+
+  int allocations() const { return allocations_; }
+  int frees() const { return frees_; }
+
+ private:
+  int allocations_;
+  int frees_;
+};
+
+class PoolFlagScope {
+ public:
+  PoolFlagScope(int size_mb, int max_length_kb)
+      : size_mb_(FLAG_array_buffer_pool_size),
+        max_length_kb_(FLAG_array_buffer_pool_max_length) {
+    FLAG_array_buffer_pool_size = size_mb;
+    FLAG_array_buffer_pool_max_length = max_length_kb;
+  }
+  ~PoolFlagScope() {
+    FLAG_array_buffer_pool_size = size_mb_;
+    FLAG_array_buffer_pool_max_length = max_length_kb_;
+  }
+
+ private:
+  int size_mb_;
+  int max_length_kb_;
+};
+
+}  // namespace
+
+TEST(ArrayBufferPool, RecyclesByLength) {
+  PoolFlagScope flags(1, 64);
+  CountingAllocator allocator;
+  ArrayBufferPool* pool = ArrayBufferPool::Acquire(&allocator);
+
+  void* data = allocator.AllocateUninitialized(4 * KB);
+  EXPECT_TRUE(pool->Add(data, 4 * KB));
+  EXPECT_EQ(4u * KB, pool->pooled_bytes());
+
+  EXPECT_EQ(nullptr, pool->Allocate(8 * KB, false));
+  EXPECT_EQ(data, pool->Allocate(4 * KB, false));
+  EXPECT_EQ(0u, pool->pooled_bytes());
+  EXPECT_EQ(nullptr, pool->Allocate(4 * KB, false));
+
+  allocator.Free(data, 4 * KB);
+  ArrayBufferPool::Release(pool);
+}
+
+TEST(ArrayBufferPool, ZeroFillsOnReuse) {
+  PoolFlagScope flags(1, 64);
+  CountingAllocator allocator;
+  ArrayBufferPool* pool = ArrayBufferPool::Acquire(&allocator);
+
+  uint8_t* data =
+      static_cast<uint8_t*>(allocator.AllocateUninitialized(4 * KB));
+  memset(data, 0xAB, 4 * KB);
+  EXPECT_TRUE(pool->Add(data, 4 * KB));
+  // Pooling leaves the contents alone.
+  EXPECT_EQ(0xAB, data[0]);
+
+  uint8_t* reused = static_cast<uint8_t*>(pool->Allocate(4 * KB, true));
+  EXPECT_EQ(data, reused);
+  for (size_t i = 0; i < 4 * KB; i++) EXPECT_EQ(0, reused[i]);
+
+  allocator.Free(reused, 4 * KB);
+  ArrayBufferPool::Release(pool);
+}
+
+TEST(ArrayBufferPool, RespectsLimits) {
+  PoolFlagScope flags(1, 64);
+  CountingAllocator allocator;
+  ArrayBufferPool* pool = ArrayBufferPool::Acquire(&allocator);
+  EXPECT_EQ(static_cast<size_t>(MB), pool->capacity());
+
+  // Too long for the pool.
+  void* large = allocator.AllocateUninitialized(128 * KB);
+  EXPECT_FALSE(pool->Add(large, 128 * KB));
+  allocator.Free(large, 128 * KB);
+
+  // Fill the pool up to its capacity.
+  const int kBuffers = MB / (64 * KB);
+  for (int i = 0; i < kBuffers; i++) {
+    EXPECT_TRUE(pool->Add(allocator.AllocateUninitialized(64 * KB), 64 * KB));
+  }
+  EXPECT_EQ(static_cast<size_t>(MB), pool->pooled_bytes());
+  void* extra = allocator.AllocateUninitialized(4 * KB);
+  EXPECT_FALSE(pool->Add(extra, 4 * KB));
+  allocator.Free(extra, 4 * KB);
+
+  // Releasing the pool returns everything to the allocator.
+  ArrayBufferPool::Release(pool);
+  EXPECT_EQ(allocator.allocations(), allocator.frees());
+}
+
+TEST(ArrayBufferPool, SharedPerAllocator) {
+  PoolFlagScope flags(1, 64);
+  CountingAllocator allocator;
+  CountingAllocator other_allocator;
+  ArrayBufferPool* pool1 = ArrayBufferPool::Acquire(&allocator);
+  ArrayBufferPool* pool2 = ArrayBufferPool::Acquire(&allocator);
+  ArrayBufferPool* other_pool = ArrayBufferPool::Acquire(&other_allocator);
+  EXPECT_EQ(pool1, pool2);
+  EXPECT_NE(pool1, other_pool);
+
+  EXPECT_TRUE(pool1->Add(allocator.AllocateUninitialized(4 * KB), 4 * KB));
+  // The pool stays alive as long as one of its users does.
+  ArrayBufferPool::Release(pool1);
+  EXPECT_EQ(0, allocator.frees());
+  EXPECT_EQ(4u * KB, pool2->pooled_bytes());
+  ArrayBufferPool::Release(pool2);
+  EXPECT_EQ(1, allocator.frees());
+  ArrayBufferPool::Release(other_pool);
+}
+
+}  // namespace internal
+}  // namespace v8
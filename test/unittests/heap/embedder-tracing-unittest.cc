@@ -37,6 +37,13 @@ class MockEmbedderHeapTracer : public EmbedderHeapTracer {
                bool(double deadline_in_ms, AdvanceTracingActions actions));
 };
 
+class MockConcurrentEmbedderHeapTracer : public MockEmbedderHeapTracer {
+ public:
+  MOCK_METHOD0(SupportsConcurrentTracing, bool());
+  MOCK_METHOD1(TraceV8ReferencesConcurrently,
+               void(const std::vector<std::pair<void*, void*> >&));
+};
+
 TEST(LocalEmbedderHeapTracer, InUse) {
   LocalEmbedderHeapTracer local_tracer;
   MockEmbedderHeapTracer mock_remote_tracer;
@@ -158,6 +165,60 @@ TEST(LocalEmbedderHeapTracer, TraceDoesNotFinish) {
   EXPECT_EQ(0u, local_tracer.NumberOfCachedWrappersToTrace());
 }
 
+TEST(LocalEmbedderHeapTracer, ConcurrentTracingDisabledIfNotSupported) {
+  LocalEmbedderHeapTracer local_tracer;
+  StrictMock<MockConcurrentEmbedderHeapTracer> remote_tracer;
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  EXPECT_CALL(remote_tracer, TracePrologue());
+  EXPECT_CALL(remote_tracer, SupportsConcurrentTracing())
+      .WillRepeatedly(Return(false));
+  local_tracer.TracePrologue();
+  EXPECT_FALSE(local_tracer.IsConcurrentTracingEnabled());
+}
+
+TEST(LocalEmbedderHeapTracer, ConcurrentTracingEnabledForOneCycle) {
+  LocalEmbedderHeapTracer local_tracer;
+  StrictMock<MockConcurrentEmbedderHeapTracer> remote_tracer;
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  EXPECT_CALL(remote_tracer, TracePrologue());
+  EXPECT_CALL(remote_tracer, SupportsConcurrentTracing())
+      .WillRepeatedly(Return(true));
+  local_tracer.TracePrologue();
+  EXPECT_EQ(FLAG_concurrent_marking && FLAG_concurrent_embedder_tracing,
+            local_tracer.IsConcurrentTracingEnabled());
+  EXPECT_CALL(remote_tracer, TraceEpilogue());
+  local_tracer.TraceEpilogue();
+  EXPECT_FALSE(local_tracer.IsConcurrentTracingEnabled());
+}
+
+TEST(LocalEmbedderHeapTracer, TraceWrappersConcurrentlyForwards) {
+  LocalEmbedderHeapTracer local_tracer;
+  StrictMock<MockConcurrentEmbedderHeapTracer> remote_tracer;
+  local_tracer.SetRemoteTracer(&remote_tracer);
+  EXPECT_CALL(remote_tracer, TracePrologue());
+  EXPECT_CALL(remote_tracer, SupportsConcurrentTracing())
+      .WillRepeatedly(Return(true));
+  local_tracer.TracePrologue();
+  if (!local_tracer.IsConcurrentTracingEnabled()) return;
+  LocalEmbedderHeapTracer::WrapperCache wrappers;
+  wrappers.push_back(CreateWrapperInfo());
+  EXPECT_CALL(remote_tracer, TraceV8ReferencesConcurrently(_));
+  local_tracer.TraceWrappersConcurrently(wrappers);
+}
+
+TEST(LocalEmbedderHeapTracer, FlushConcurrentlyDiscoveredObjects) {
+  LocalEmbedderHeapTracer local_tracer;
+  HeapObject* object = reinterpret_cast<HeapObject*>(kHeapObjectTag);
+  local_tracer.AddConcurrentlyDiscoveredObject(object);
+  local_tracer.AddConcurrentlyDiscoveredObject(object);
+  std::vector<HeapObject*> objects;
+  local_tracer.FlushConcurrentlyDiscoveredObjects(&objects);
+  EXPECT_EQ(2u, objects.size());
+  objects.clear();
+  local_tracer.FlushConcurrentlyDiscoveredObjects(&objects);
+  EXPECT_TRUE(objects.empty());
+}
+
 }  // namespace heap
 }  // namespace internal
 }  // namespace v8
@@ -451,5 +451,59 @@ TEST_F(GCTracerTest, MultithreadedBackgroundScope) {
   EXPECT_LE(0, tracer->current_.scopes[GCTracer::Scope::MC_BACKGROUND_MARKING]);
 }
 
+namespace {
+
+struct StatisticsRecorder {
+  int calls = 0;
+  v8::GCStatistics last;
+};
+
+void RecordStatistics(v8::Isolate* isolate,
+                      const v8::GCStatistics& statistics, void* data) {
+  StatisticsRecorder* recorder = static_cast<StatisticsRecorder*>(data);
+  recorder->calls++;
+  recorder->last = statistics;
+}
+
+}  // namespace
+
+TEST_F(GCTracerTest, StatisticsCallback) {
+  GCTracer* tracer = i_isolate()->heap()->tracer();
+  StatisticsRecorder recorder;
+  isolate()->AddGCStatisticsCallback(RecordStatistics, &recorder);
+
+  tracer->Start(MARK_COMPACTOR, GarbageCollectionReason::kTesting,
+                "collector unittest");
+  tracer->AddScopeSample(GCTracer::Scope::MC_MARK, 100);
+  tracer->AddScopeSample(GCTracer::Scope::MC_EVACUATE, 50);
+  tracer->AddScopeSample(GCTracer::Scope::HEAP_EXTERNAL_EPILOGUE, 10);
+  tracer->Stop(MARK_COMPACTOR);
+  tracer->InvokeStatisticsCallbacks();
+
+  EXPECT_EQ(1, recorder.calls);
+  EXPECT_EQ(v8::kGCTypeMarkSweepCompact, recorder.last.gc_type());
+  EXPECT_DOUBLE_EQ(100.0,
+                   recorder.last.phase_duration(v8::GCStatistics::kMark));
+  EXPECT_DOUBLE_EQ(50.0,
+                   recorder.last.phase_duration(v8::GCStatistics::kEvacuate));
+  EXPECT_DOUBLE_EQ(10.0, recorder.last.phase_duration(
+                             v8::GCStatistics::kEmbedderCallbacks));
+  EXPECT_DOUBLE_EQ(0.0, recorder.last.phase_duration(v8::GCStatistics::kSweep));
+  EXPECT_EQ(static_cast<size_t>(LAST_SPACE + 1),
+            recorder.last.number_of_spaces());
+  EXPECT_LE(0.0, recorder.last.pause_duration());
+
+  // A real garbage collection reports through the same callback.
+  i_isolate()->heap()->CollectGarbage(NEW_SPACE,
+                                      GarbageCollectionReason::kTesting);
+  EXPECT_EQ(2, recorder.calls);
+  EXPECT_EQ(v8::kGCTypeScavenge, recorder.last.gc_type());
+
+  isolate()->RemoveGCStatisticsCallback(RecordStatistics, &recorder);
+  i_isolate()->heap()->CollectGarbage(NEW_SPACE,
+                                      GarbageCollectionReason::kTesting);
+  EXPECT_EQ(2, recorder.calls);
+}
+
 }  // namespace internal
 }  // namespace v8
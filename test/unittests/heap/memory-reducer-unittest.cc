@@ -61,6 +61,7 @@ MemoryReducer::Event TimerEvent(double time_ms,
   event.time_ms = time_ms;
   event.should_start_incremental_gc = should_start_incremental_gc;
   event.can_start_incremental_gc = can_start_incremental_gc;
+  event.quiet_period_delay_ms = -1;
   return event;
 }
 
@@ -329,5 +330,65 @@ TEST(MemoryReducer, FromRunToWait) {
   EXPECT_EQ(2000, state1.last_gc_time_ms);
 }
 
+
+TEST(MemoryReducer, PredictedQuietPeriodShortensWait) {
+  if (!FLAG_incremental_marking) return;
+  bool predictive_memory_reducer = FLAG_predictive_memory_reducer;
+  FLAG_predictive_memory_reducer = true;
+
+  MemoryReducer::State state0(WaitState(2, 1000.0)), state1(DoneState());
+
+  MemoryReducer::Event event = TimerEventHighAllocationRate(2000);
+  event.quiet_period_delay_ms = 1000;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(MemoryReducer::kWait, state1.action);
+  EXPECT_EQ(3000, state1.next_gc_start_ms);
+
+  event.quiet_period_delay_ms = 1;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(2000 + MemoryReducer::kShortDelayMs, state1.next_gc_start_ms);
+
+  event.quiet_period_delay_ms = 10 * MemoryReducer::kLongDelayMs;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(2000 + MemoryReducer::kLongDelayMs, state1.next_gc_start_ms);
+
+  event.quiet_period_delay_ms = -1;
+  state1 = MemoryReducer::Step(state0, event);
+  EXPECT_EQ(2000 + MemoryReducer::kLongDelayMs, state1.next_gc_start_ms);
+
+  FLAG_predictive_memory_reducer = predictive_memory_reducer;
+}
+
+
+TEST(AllocationRateForecaster, PredictsQuietPeriod) {
+  AllocationRateForecaster forecaster;
+  EXPECT_GT(0, forecaster.PredictDelayUntilBelow(100, 0));
+
+  // A steady rate is not expected to drop.
+  for (int i = 0; i < 10; i++) forecaster.AddSample(i * 100, 1000);
+  EXPECT_DOUBLE_EQ(1000, forecaster.level());
+  EXPECT_GT(0, forecaster.PredictDelayUntilBelow(100, 900));
+  EXPECT_EQ(0, forecaster.PredictDelayUntilBelow(1000, 900));
+
+  // A falling rate is extrapolated to reach the threshold later.
+  for (int i = 10; i < 15; i++) {
+    forecaster.AddSample(i * 100, 1000 - (i - 9) * 100);
+  }
+  EXPECT_GT(0, forecaster.trend());
+  double delay = forecaster.PredictDelayUntilBelow(100, 1400);
+  EXPECT_LT(0, delay);
+  EXPECT_NEAR(100, forecaster.level() + forecaster.trend() * delay, 1e-6);
+
+  // The delay is measured from the query, not from the last sample.
+  EXPECT_EQ(1400, forecaster.last_time_ms());
+  EXPECT_NEAR(delay - 10, forecaster.PredictDelayUntilBelow(100, 1410), 1e-6);
+  EXPECT_EQ(0, forecaster.PredictDelayUntilBelow(100, 1400 + delay + 10));
+
+  // Samples that do not advance time are ignored.
+  double level = forecaster.level();
+  forecaster.AddSample(1400, 0);
+  EXPECT_EQ(level, forecaster.level());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -80,6 +80,30 @@ TEST_F(SequentialUnmapperTest, UnmapOnTeardown) {
   EXPECT_EQ(-1, msync(start_address, page_size, MS_SYNC));
 }
 
+TEST_F(SequentialUnmapperTest, PooledPageKeepsNumaNode) {
+  const bool old_flag = i::FLAG_numa_aware_page_allocation;
+  i::FLAG_numa_aware_page_allocation = true;
+  const bool numa_supported =
+      GetCurrentNumaNode() != PageAllocator::kNoNumaNode;
+  Page* page =
+      allocator()->AllocatePage(MemoryAllocator::PageAreaSize(OLD_SPACE),
+                                static_cast<PagedSpace*>(heap()->old_space()),
+                                Executability::NOT_EXECUTABLE);
+  EXPECT_NE(nullptr, page);
+  EXPECT_EQ(numa_supported, page->numa_node() != PageAllocator::kNoNumaNode);
+  allocator()->Free<MemoryAllocator::kPooledAndQueue>(page);
+  unmapper()->FreeQueuedChunks();
+  // The uncommitted page is handed out again and is bound to a node.
+  Page* pooled = allocator()->AllocatePage<MemoryAllocator::kPooled>(
+      MemoryChunk::kAllocatableMemory, heap()->new_space()->active_space(),
+      Executability::NOT_EXECUTABLE);
+  EXPECT_EQ(page, pooled);
+  EXPECT_EQ(numa_supported, pooled->numa_node() != PageAllocator::kNoNumaNode);
+  allocator()->Free<MemoryAllocator::kPooledAndQueue>(pooled);
+  unmapper()->TearDown();
+  i::FLAG_numa_aware_page_allocation = old_flag;
+}
+
 #endif  // __linux__
 
 }  // namespace internal
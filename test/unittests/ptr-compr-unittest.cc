@@ -0,0 +1,64 @@
+// Copyright 2018 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/ptr-compr-inl.h"
+
+#include "src/objects.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+#if V8_TARGET_ARCH_64_BIT
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+const Address kRoot = uint64_t{0x12300000000};
+const Address kReservationStart = kRoot - kPtrComprIsolateRootBias;
+const Address kReservationEnd =
+    kReservationStart + kPtrComprHeapReservationSize;
+
+}  // namespace
+
+TEST(PtrComprTest, RootFromOnHeapAddress) {
+  EXPECT_EQ(0u, kRoot % kPtrComprIsolateRootAlignment);
+  EXPECT_EQ(kRoot, GetRootFromOnHeapAddress(kRoot));
+  EXPECT_EQ(kRoot, GetRootFromOnHeapAddress(kReservationStart));
+  EXPECT_EQ(kRoot, GetRootFromOnHeapAddress(kReservationEnd - 1));
+  EXPECT_NE(kRoot, GetRootFromOnHeapAddress(kReservationEnd));
+  EXPECT_NE(kRoot, GetRootFromOnHeapAddress(kReservationStart - 1));
+}
+
+TEST(PtrComprTest, HeapObjectRoundTrip) {
+  const Address objects[] = {kReservationStart + kHeapObjectTag,
+                             kRoot - kPointerSize + kHeapObjectTag,
+                             kRoot + kHeapObjectTag,
+                             kReservationEnd - kPointerSize + kHeapObjectTag};
+  for (Address object : objects) {
+    int32_t compressed = CompressTagged(object);
+    EXPECT_EQ(object, DecompressTaggedPointer(kRoot, compressed));
+    EXPECT_EQ(object, DecompressTaggedAny(kRoot, compressed));
+    // Any on-heap address of the same reservation can be used as the base.
+    EXPECT_EQ(object, DecompressTaggedPointer(object, compressed));
+    EXPECT_EQ(object, DecompressTaggedAny(kReservationStart, compressed));
+  }
+}
+
+TEST(PtrComprTest, SmiRoundTrip) {
+  // Values in the 31-bit range round-trip with either Smi layout.
+  const int values[] = {0, 1, -1, kMaxInt >> 1, kMinInt >> 1};
+  for (int value : values) {
+    Address smi = reinterpret_cast<Address>(Smi::FromInt(value));
+    int32_t compressed = CompressTagged(smi);
+    // The compressed form is the 31-bit layout: value << 1.
+    EXPECT_EQ(value, compressed >> kSmiTagSize);
+    EXPECT_EQ(smi, DecompressTaggedSigned(compressed));
+    EXPECT_EQ(smi, DecompressTaggedAny(kRoot, compressed));
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_TARGET_ARCH_64_BIT
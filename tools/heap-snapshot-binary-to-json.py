@@ -0,0 +1,131 @@
+#!/usr/bin/env python
+# Copyright 2018 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+"""Converts a heap snapshot written with v8::HeapSnapshot::kBinary into the
+JSON format understood by DevTools.
+
+Usage: heap-snapshot-binary-to-json.py input.heapbin [output.heapsnapshot]
+"""
+
+import json
+import sys
+
+MAGIC = b'V8HS'
+VERSION = 1
+
+NODE_FIELDS = ['type', 'name', 'id', 'self_size', 'edge_count',
+               'trace_node_id']
+EDGE_FIELDS = ['type', 'name_or_index', 'to_node']
+
+# Must match HeapSnapshotJSONSerializer::SerializeSnapshot.
+META = {
+  'node_fields': NODE_FIELDS,
+  'node_types': [['hidden', 'array', 'string', 'object', 'code', 'closure',
+                  'regexp', 'number', 'native', 'synthetic',
+                  'concatenated string', 'sliced string', 'symbol',
+                  'bigint'],
+                 'string', 'number', 'number', 'number', 'number', 'number'],
+  'edge_fields': EDGE_FIELDS,
+  'edge_types': [['context', 'element', 'property', 'internal', 'hidden',
+                  'shortcut', 'weak'],
+                 'string_or_number', 'node'],
+  'trace_function_info_fields': ['function_id', 'name', 'script_name',
+                                 'script_id', 'line', 'column'],
+  'trace_node_fields': ['id', 'function_info_index', 'count', 'size',
+                        'children'],
+  'sample_fields': ['timestamp_us', 'last_assigned_id'],
+}
+
+
+class Reader(object):
+  def __init__(self, data):
+    self.data = bytearray(data)
+    self.pos = 0
+
+  def varint(self):
+    result = 0
+    shift = 0
+    while True:
+      byte = self.data[self.pos]
+      self.pos += 1
+      result |= (byte & 0x7f) << shift
+      if byte < 0x80:
+        return result
+      shift += 7
+
+  def signed_varint(self):
+    value = self.varint()
+    return (value >> 1) ^ -(value & 1)
+
+  def bytes(self, length):
+    result = self.data[self.pos:self.pos + length]
+    self.pos += length
+    return bytes(result)
+
+
+def Convert(data):
+  if data[:len(MAGIC)] != MAGIC:
+    raise Exception('Not a binary heap snapshot')
+  reader = Reader(data[len(MAGIC):])
+  version = reader.varint()
+  if version != VERSION:
+    raise Exception('Unsupported binary heap snapshot version %d' % version)
+  node_count = reader.varint()
+  edge_count = reader.varint()
+  sample_count = reader.varint()
+
+  nodes = []
+  node_id = 0
+  for _ in range(node_count):
+    node_type = reader.varint()
+    name = reader.varint()
+    node_id += reader.signed_varint()
+    nodes.extend([node_type, name, node_id, reader.varint(), reader.varint(),
+                  reader.varint()])
+
+  edges = []
+  for _ in range(edge_count):
+    edges.extend([reader.varint(), reader.varint(),
+                  reader.varint() * len(NODE_FIELDS)])
+
+  samples = []
+  for _ in range(sample_count):
+    samples.extend([reader.varint(), reader.varint()])
+
+  strings = ['<dummy>']
+  for _ in range(reader.varint()):
+    strings.append(reader.bytes(reader.varint()).decode('utf-8', 'replace'))
+
+  return {
+    'snapshot': {
+      'meta': META,
+      'node_count': node_count,
+      'edge_count': edge_count,
+      'trace_function_count': 0,
+    },
+    'nodes': nodes,
+    'edges': edges,
+    'trace_function_infos': [],
+    'trace_tree': [],
+    'samples': samples,
+    'strings': strings,
+  }
+
+
+def Main(argv):
+  if len(argv) not in (2, 3):
+    print(__doc__)
+    return 1
+  with open(argv[1], 'rb') as f:
+    snapshot = Convert(f.read())
+  output = open(argv[2], 'w') if len(argv) == 3 else sys.stdout
+  json.dump(snapshot, output, separators=(',', ':'))
+  if output is not sys.stdout:
+    output.close()
+  return 0
+
+
+if __name__ == '__main__':
+  sys.exit(Main(sys.argv))